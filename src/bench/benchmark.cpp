@@ -0,0 +1,301 @@
+/**
+ * @file benchmark.cpp
+ * @author Victor Emanuel Almeida e Milena Lucas dos Santos
+ * @brief Implementa todas as funcionalidade da classe Benchmark
+ * @version 0.1
+ * @date 17/10/2026
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <streambuf>
+#include <sys/resource.h>
+
+#include "benchmark.hpp"
+
+/**
+ * @brief streambuf que descarta tudo, para os algoritmos não escreverem
+ * no terminal durante a medição
+ */
+class BufferNulo : public std::streambuf {
+    private:
+    char buf[1 << 12];
+
+    protected:
+    int overflow(int c) override {
+        setp(buf, buf + sizeof(buf));
+        return c == EOF ? 0 : c;
+    }
+};
+
+/**
+ * @brief Zera o pico de memória residente do processo (VmHWM)
+ *
+ * Somente no Linux, se não for possível o pico continua sendo o do
+ * processo inteiro
+ */
+static void reiniciaPicoMemoria() {
+    std::ofstream file("/proc/self/clear_refs");
+    if (file.is_open()) {
+        file << "5";
+    }
+}
+
+/**
+ * @brief Pico de memória residente em KB desde o último
+ * reiniciaPicoMemoria
+ */
+static long long picoMemoria() {
+    std::ifstream file("/proc/self/status");
+    std::string linha;
+    while (std::getline(file, linha)) {
+        if (linha.compare(0, 6, "VmHWM:") == 0) {
+            return atoll(linha.c_str() + 6);
+        }
+    }
+    struct rusage uso;
+    getrusage(RUSAGE_SELF, &uso);
+    return uso.ru_maxrss;
+}
+
+/**
+ * @brief Percentil q dos tempos, que devem estar ordenados
+ */
+static double percentil(const std::vector<double> &tempos, double q) {
+    int i = (int)std::ceil(q * tempos.size()) - 1;
+    return tempos[std::max(0, i)];
+}
+
+/**
+ * @brief Construtor da classe Benchmark
+ *
+ * @param aquecimento execuções descartadas antes de medir
+ * @param repeticoes execuções medidas, no mínimo 1
+ * @pre Nenhuma
+ * @post Nenhuma
+ */
+Benchmark::Benchmark(int aquecimento, int repeticoes) {
+    debug("Construindo Benchmark\n");
+    this->aquecimento = std::max(0, aquecimento);
+    this->repeticoes = std::max(1, repeticoes);
+    origem = -1;
+}
+
+/**
+ * @brief Define a origem das buscas e dos menores caminhos
+ *
+ * @param origem vértice de origem, -1 para o de maior grau
+ */
+void Benchmark::defineOrigem(int origem) {
+    this->origem = origem;
+}
+
+/**
+ * @brief Restringe os algoritmos medidos
+ *
+ * @param algoritmos nomes separados por vírgula, ver executa
+ */
+void Benchmark::defineAlgoritmos(const std::string &algoritmos) {
+    std::istringstream in(algoritmos);
+    std::string nome;
+    this->algoritmos.clear();
+    while (std::getline(in, nome, ',')) {
+        if (!nome.empty()) {
+            this->algoritmos.push_back(nome);
+        }
+    }
+}
+
+/**
+ * @brief Informa se o algoritmo foi selecionado
+ */
+bool Benchmark::selecionado(const std::string &algoritmo) const {
+    return algoritmos.empty() ||
+           std::find(algoritmos.begin(), algoritmos.end(), algoritmo) != algoritmos.end();
+}
+
+/**
+ * @brief Carrega o grafo e mede todos os algoritmos selecionados
+ *
+ * Algoritmos: ler, dfs, bfs-fila, bfs-direcao, bfs-paralela,
+ * bellman-ford, spfa, bellman-ford-paralelo, dijkstra, goldberg-radzik,
+ * delta-stepping, kruskal, filter-kruskal, boruvka e prim. Os que não
+ * atendem ao grafo (ex.: dijkstra com pesos negativos) são pulados.
+ * Cada medição é mostrada na saída padrão assim que termina
+ * @param arquivo grafo no formato texto ou binário
+ * @return true se o grafo foi carregado
+ * @pre Nenhuma
+ * @post medições adicionadas
+ */
+bool Benchmark::executa(const std::string &arquivo) {
+    Grafo g;
+    g.ler(arquivo);
+    if (g.grafo == nullptr) {
+        return false;
+    }
+
+    // sem origem definida, a de maior grau alcança a maior parte do grafo
+    int v = origem;
+    if (v < 0 || v >= g.qnt_nos) {
+        v = 0;
+        for (int u = 1; u < g.qnt_nos; u++) {
+            if (g.grafo->grau(u) > g.grafo->grau(v)) {
+                v = u;
+            }
+        }
+    }
+    bool negativo = g.grafo->temPesoNegativo();
+    // no grafo não orientado uma aresta negativa já é um ciclo
+    bool caminhos = g.isOrientado || !negativo;
+
+    struct Algoritmo {
+        const char *nome;
+        bool aplicavel;
+        std::function<void()> executa;
+    };
+    const Algoritmo lista[] = {
+        {"ler", true, [&] { g.descartaGrafo(); g.ler(arquivo); }},
+        {"dfs", true, [&] { g.buscaEmProfundidade(v); }},
+        {"bfs-fila", true, [&] { g.buscaEmLargura(v, BUSCA_FILA); }},
+        {"bfs-direcao", true, [&] { g.buscaEmLargura(v, BUSCA_DIRECAO_OTIMIZADA); }},
+        {"bfs-paralela", true, [&] { g.buscaEmLargura(v, BUSCA_PARALELA); }},
+        {"bellman-ford", caminhos, [&] { g.caminhoMinimo(v, BELLMAN_FORD); }},
+        {"spfa", caminhos, [&] { g.caminhoMinimo(v, BELLMAN_FORD_FILA); }},
+        {"bellman-ford-paralelo", caminhos, [&] { g.caminhoMinimo(v, BELLMAN_FORD_PARALELO); }},
+        {"dijkstra", caminhos && !negativo, [&] { g.caminhoMinimo(v, DIJKSTRA); }},
+        {"goldberg-radzik", caminhos, [&] { g.caminhoMinimo(v, GOLDBERG_RADZIK); }},
+        {"delta-stepping", caminhos && !negativo, [&] { g.caminhoMinimo(v, DELTA_STEPPING); }},
+        {"kruskal", true, [&] { g.arvoreGeradoraMinima(KRUSKAL); }},
+        {"filter-kruskal", true, [&] { g.arvoreGeradoraMinima(FILTER_KRUSKAL); }},
+        {"boruvka", true, [&] { g.arvoreGeradoraMinima(BORUVKA); }},
+        {"prim", !g.isOrientado, [&] { g.arvoreGeradoraMinima(PRIM); }},
+    };
+
+    BufferNulo nulo;
+    for (const Algoritmo &a : lista) {
+        if (!a.aplicavel || !selecionado(a.nome)) {
+            continue;
+        }
+        reiniciaPicoMemoria();
+        std::vector<double> tempos;
+        std::streambuf *antigo = std::cout.rdbuf(&nulo);
+        for (int i = 0; i < aquecimento + repeticoes; i++) {
+            auto inicio = std::chrono::steady_clock::now();
+            a.executa();
+            auto fim = std::chrono::steady_clock::now();
+            if (i >= aquecimento) {
+                tempos.push_back(std::chrono::duration<double, std::milli>(fim - inicio).count());
+            }
+        }
+        std::cout.rdbuf(antigo);
+        std::sort(tempos.begin(), tempos.end());
+
+        Medicao m;
+        m.grafo = arquivo;
+        m.algoritmo = a.nome;
+        m.qnt_nos = g.qnt_nos;
+        m.qnt_entradas = g.grafo->qntEntradas();
+        m.repeticoes = repeticoes;
+        m.mediana_ms = percentil(tempos, 0.5);
+        m.p95_ms = percentil(tempos, 0.95);
+        m.minimo_ms = tempos[0];
+        m.arestas_por_s = m.mediana_ms > 0 ? m.qnt_entradas / (m.mediana_ms / 1000) : 0;
+        m.pico_rss_kb = picoMemoria();
+        medicoes.push_back(m);
+
+        std::cout << std::left << std::setw(24) << m.algoritmo << std::right
+                  << std::fixed << std::setprecision(3)
+                  << std::setw(12) << m.mediana_ms << " ms"
+                  << std::setw(12) << m.p95_ms << " ms (p95)"
+                  << std::setprecision(0) << std::setw(14) << m.arestas_por_s << " arestas/s"
+                  << std::setw(10) << m.pico_rss_kb << " KB\n" << std::flush;
+    }
+    return true;
+}
+
+/**
+ * @brief Texto entre aspas, com as aspas e barras escapadas para JSON
+ */
+static std::string textoJSON(const std::string &s) {
+    std::string r = "\"";
+    for (char c : s) {
+        if (c == '"' || c == '\\') {
+            r += '\\';
+        }
+        r += c;
+    }
+    return r + '"';
+}
+
+/**
+ * @brief Grava todas as medições em JSON, um objeto por medição
+ *
+ * @param filename arquivo de saída
+ * @return true se o arquivo foi escrito
+ */
+bool Benchmark::escreveJSON(const std::string &filename) const {
+    std::ofstream file(filename, std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+    file << std::fixed << "[\n";
+    for (size_t i = 0; i < medicoes.size(); i++) {
+        const Medicao &m = medicoes[i];
+        file << std::setprecision(3)
+             << "  {\"grafo\": " << textoJSON(m.grafo)
+             << ", \"algoritmo\": " << textoJSON(m.algoritmo)
+             << ", \"vertices\": " << m.qnt_nos
+             << ", \"entradas\": " << m.qnt_entradas
+             << ", \"repeticoes\": " << m.repeticoes
+             << ", \"mediana_ms\": " << m.mediana_ms
+             << ", \"p95_ms\": " << m.p95_ms
+             << ", \"minimo_ms\": " << m.minimo_ms
+             << std::setprecision(0)
+             << ", \"arestas_por_s\": " << m.arestas_por_s
+             << ", \"pico_rss_kb\": " << m.pico_rss_kb << '}'
+             << (i + 1 < medicoes.size() ? ",\n" : "\n");
+    }
+    file << "]\n";
+    return file.good();
+}
+
+/**
+ * @brief Grava todas as medições em CSV, com cabeçalho
+ *
+ * @param filename arquivo de saída
+ * @return true se o arquivo foi escrito
+ */
+bool Benchmark::escreveCSV(const std::string &filename) const {
+    std::ofstream file(filename, std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+    file << "grafo,algoritmo,vertices,entradas,repeticoes,mediana_ms,p95_ms,"
+            "minimo_ms,arestas_por_s,pico_rss_kb\n" << std::fixed;
+    for (const Medicao &m : medicoes) {
+        // o nome do arquivo vai entre aspas, com as aspas duplicadas
+        std::string grafo;
+        for (char c : m.grafo) {
+            grafo += c;
+            if (c == '"') {
+                grafo += c;
+            }
+        }
+        file << '"' << grafo << "\"," << m.algoritmo << ',' << m.qnt_nos << ','
+             << m.qnt_entradas << ',' << m.repeticoes << ','
+             << std::setprecision(3) << m.mediana_ms << ',' << m.p95_ms << ','
+             << m.minimo_ms << ',' << std::setprecision(0) << m.arestas_por_s << ','
+             << m.pico_rss_kb << '\n';
+    }
+    return file.good();
+}
+
+Benchmark::~Benchmark() {
+    debug("Destruindo Benchmark\n");
+}
@@ -0,0 +1,115 @@
+/**
+ * @file benchmark.hpp
+ * @author Victor Emanuel Almeida e Milena Lucas dos Santos
+ * @brief Define a classe Benchmark, que mede o tempo dos algoritmos
+ *
+ * @version 0.1
+ * @date 17/10/2026
+ */
+
+#ifndef BENCHMARK
+#define BENCHMARK
+
+#include <string>
+#include <vector>
+#include "../utils/debug.hpp"
+#include "../grafo/grafo.hpp"
+
+/**
+ * @brief Resultado das repetições de um algoritmo em um grafo
+ */
+struct Medicao {
+    std::string grafo;  /// arquivo do grafo
+    std::string algoritmo;
+    int qnt_nos;
+    long long qnt_entradas;  /// entradas das listas de adjacência
+    int repeticoes;
+    double mediana_ms;
+    double p95_ms;
+    double minimo_ms;
+    double arestas_por_s;  /// entradas divididas pela mediana
+    long long pico_rss_kb;  /// maior memória residente durante as repetições
+};
+
+/**
+ * @brief Executa cada algoritmo do Grafo várias vezes e guarda as
+ * estatísticas dos tempos
+ *
+ * Os algoritmos são chamados pelos mesmos métodos públicos do menu, com
+ * a saída padrão descartada, então o tempo inclui a formatação do
+ * resultado mas não a escrita no terminal
+ */
+class Benchmark {
+    private:
+    int aquecimento;  /// execuções descartadas antes de medir
+    int repeticoes;  /// execuções medidas
+    int origem;  /// origem das buscas, -1 para o vértice de maior grau
+    std::vector<std::string> algoritmos;  /// algoritmos a medir, vazio
+    /// para todos
+    std::vector<Medicao> medicoes;
+
+    /**
+     * @brief Informa se o algoritmo foi selecionado
+     */
+    bool selecionado(const std::string &algoritmo) const;
+
+    public:
+    /**
+     * @brief Construtor da classe Benchmark
+     *
+     * @param aquecimento execuções descartadas antes de medir
+     * @param repeticoes execuções medidas, no mínimo 1
+     * @pre Nenhuma
+     * @post Nenhuma
+     */
+    Benchmark(int aquecimento, int repeticoes);
+
+    /**
+     * @brief Define a origem das buscas e dos menores caminhos
+     *
+     * @param origem vértice de origem, -1 para o de maior grau
+     */
+    void defineOrigem(int origem);
+
+    /**
+     * @brief Restringe os algoritmos medidos
+     *
+     * @param algoritmos nomes separados por vírgula, ver executa
+     */
+    void defineAlgoritmos(const std::string &algoritmos);
+
+    /**
+     * @brief Carrega o grafo e mede todos os algoritmos selecionados
+     *
+     * Algoritmos: ler, dfs, bfs-fila, bfs-direcao, bfs-paralela,
+     * bellman-ford, spfa, bellman-ford-paralelo, dijkstra, goldberg-radzik,
+     * delta-stepping, kruskal, filter-kruskal, boruvka e prim. Os que não
+     * atendem ao grafo (ex.: dijkstra com pesos negativos) são pulados.
+     * Cada medição é mostrada na saída padrão assim que termina
+     * @param arquivo grafo no formato texto ou binário
+     * @return true se o grafo foi carregado
+     * @pre Nenhuma
+     * @post medições adicionadas
+     */
+    bool executa(const std::string &arquivo);
+
+    /**
+     * @brief Grava todas as medições em JSON, um objeto por medição
+     *
+     * @param filename arquivo de saída
+     * @return true se o arquivo foi escrito
+     */
+    bool escreveJSON(const std::string &filename) const;
+
+    /**
+     * @brief Grava todas as medições em CSV, com cabeçalho
+     *
+     * @param filename arquivo de saída
+     * @return true se o arquivo foi escrito
+     */
+    bool escreveCSV(const std::string &filename) const;
+
+    ~Benchmark();
+};
+
+#endif // BENCHMARK
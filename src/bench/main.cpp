@@ -0,0 +1,84 @@
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "benchmark.hpp"
+
+using namespace std;
+
+/**
+ * @brief Mostra como utilizar o benchmark
+ */
+static void uso(const char *programa) {
+    cout << "Uso: " << programa << " [opções] <grafo>...\n"
+         << "opções:\n"
+         << "  --aquecimento W     execuções descartadas (padrão 1)\n"
+         << "  --repeticoes N      execuções medidas (padrão 5)\n"
+         << "  --origem V          origem das buscas (padrão: maior grau)\n"
+         << "  --algoritmos A,B    somente os algoritmos listados\n"
+         << "  --json ARQUIVO      grava as medições em JSON\n"
+         << "  --csv ARQUIVO       grava as medições em CSV\n"
+         << "algoritmos: ler, dfs, bfs-fila, bfs-direcao, bfs-paralela,\n"
+         << "bellman-ford, spfa, bellman-ford-paralelo, dijkstra, goldberg-radzik,\n"
+         << "delta-stepping, kruskal, filter-kruskal, boruvka, prim\n";
+}
+
+int main(int argc, char *argv[]) {
+    int aquecimento = 1, repeticoes = 5, origem = -1;
+    string algoritmos, json, csv;
+    vector<string> grafos;
+    for (int i = 1; i < argc; i++) {
+        string opcao = argv[i];
+        if (opcao.compare(0, 2, "--") != 0) {
+            grafos.push_back(opcao);
+            continue;
+        }
+        if (i + 1 >= argc) {
+            cout << "valor faltando para " << opcao << '\n';
+            return 1;
+        }
+        string valor = argv[++i];
+        if (opcao == "--aquecimento") {
+            aquecimento = atoi(valor.c_str());
+        } else if (opcao == "--repeticoes") {
+            repeticoes = atoi(valor.c_str());
+        } else if (opcao == "--origem") {
+            origem = atoi(valor.c_str());
+        } else if (opcao == "--algoritmos") {
+            algoritmos = valor;
+        } else if (opcao == "--json") {
+            json = valor;
+        } else if (opcao == "--csv") {
+            csv = valor;
+        } else {
+            cout << "opção desconhecida: " << opcao << '\n';
+            uso(argv[0]);
+            return 1;
+        }
+    }
+    if (grafos.empty()) {
+        uso(argv[0]);
+        return 1;
+    }
+
+    Benchmark bench(aquecimento, repeticoes);
+    bench.defineOrigem(origem);
+    bench.defineAlgoritmos(algoritmos);
+    int ret = 0;
+    for (const string &grafo : grafos) {
+        cout << "== " << grafo << '\n';
+        if (!bench.executa(grafo)) {
+            cout << "Não foi possível carregar " << grafo << '\n';
+            ret = 1;
+        }
+    }
+    if (!json.empty() && !bench.escreveJSON(json)) {
+        cout << "Não foi possível escrever em " << json << '\n';
+        ret = 1;
+    }
+    if (!csv.empty() && !bench.escreveCSV(csv)) {
+        cout << "Não foi possível escrever em " << csv << '\n';
+        ret = 1;
+    }
+    return ret;
+}
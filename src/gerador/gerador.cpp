@@ -0,0 +1,293 @@
+/**
+ * @file gerador.cpp
+ * @author Victor Emanuel Almeida e Milena Lucas dos Santos
+ * @brief Implementa todas as funcionalidade da classe Gerador
+ * @version 0.1
+ * @date 17/10/2026
+ */
+
+#include <algorithm>
+#include <charconv>
+#include <climits>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#include "gerador.hpp"
+#include "../grafo/grafo_csr.hpp"
+#include "../utils/paralelo.hpp"
+
+/**
+ * @brief Parâmetros padrão: R-MAT orientado com 2^10 vértices e
+ * as probabilidades do Graph500
+ */
+ParametrosGerador::ParametrosGerador() {
+    tipo = RMAT;
+    qnt_nos = 1 << 10;
+    qnt_arestas = 0;
+    escala = 0;
+    linhas = colunas = 0;
+    semente = 1;
+    peso_min = 1;
+    peso_max = 100;
+    orientado = true;
+    a = 0.57;
+    b = 0.19;
+    c = 0.19;
+}
+
+/**
+ * @brief Construtor da classe Gerador
+ *
+ * Calcula a quantidade de vértices e arestas a partir dos parâmetros
+ * @param p parâmetros do grafo
+ * @pre Nenhuma
+ * @post Nenhuma
+ */
+Gerador::Gerador(const ParametrosGerador &p) {
+    debug("Construindo Gerador\n");
+    this->p = p;
+    switch (this->p.tipo) {
+        case RMAT:
+            // sem escala, a menor potência de 2 com os vértices pedidos
+            if (this->p.escala <= 0) {
+                this->p.escala = 1;
+                while (this->p.escala < 62 &&
+                       (1LL << this->p.escala) < this->p.qnt_nos) {
+                    this->p.escala++;
+                }
+            }
+            this->p.qnt_nos = this->p.escala < 62 ? 1LL << this->p.escala : LLONG_MAX;
+            qnt_arestas = this->p.qnt_arestas > 0 ? this->p.qnt_arestas
+                        : ARESTAS_POR_VERTICE_RMAT * this->p.qnt_nos;
+            break;
+        case ERDOS_RENYI:
+            qnt_arestas = this->p.qnt_arestas > 0 ? this->p.qnt_arestas
+                        : ARESTAS_POR_VERTICE_ER * this->p.qnt_nos;
+            break;
+        case GRADE:
+            if (this->p.linhas <= 0 || this->p.colunas <= 0) {
+                int lado = std::max(1, (int)std::ceil(std::sqrt((double)this->p.qnt_nos)));
+                this->p.linhas = this->p.colunas = lado;
+            }
+            this->p.qnt_nos = (long long)this->p.linhas * this->p.colunas;
+            qnt_arestas = (long long)this->p.linhas * (this->p.colunas - 1) +
+                          (long long)(this->p.linhas - 1) * this->p.colunas;
+            break;
+        case CADEIA:
+        case ESTRELA:
+            qnt_arestas = std::max(0LL, this->p.qnt_nos - 1);
+            break;
+    }
+}
+
+/**
+ * @brief Informa se os parâmetros geram um grafo válido
+ *
+ * @param erro recebe o motivo quando os parâmetros são inválidos
+ * @return true se o grafo pode ser gerado
+ */
+bool Gerador::valido(std::string &erro) const {
+    if (p.qnt_nos < 1 || p.qnt_nos > INT_MAX) {
+        erro = "a quantidade de vértices deve estar em [1, 2^31)";
+        return false;
+    }
+    if (p.tipo == ERDOS_RENYI && p.qnt_nos < 2) {
+        erro = "o Erdős–Rényi precisa de pelo menos 2 vértices";
+        return false;
+    }
+    if (p.peso_min > p.peso_max) {
+        erro = "o peso mínimo é maior que o máximo";
+        return false;
+    }
+    if (p.tipo == RMAT && (p.a < 0 || p.b < 0 || p.c < 0 || p.a + p.b + p.c > 1)) {
+        erro = "probabilidades do R-MAT inválidas";
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Embaralha os vértices do R-MAT, para os de grau alto não
+ * ficarem todos no começo
+ *
+ * Multiplicar por um ímpar e somar são bijeções módulo 2^escala
+ */
+int Gerador::embaralha(uint64_t v) const {
+    uint64_t mascara = (1ULL << p.escala) - 1;
+    v = (v * 0x9E3779B97F4A7C15ULL + p.semente) & mascara;
+    v ^= v >> (p.escala / 2 + 1);
+    v = (v * 0xBF58476D1CE4E5B9ULL) & mascara;
+    return (int)v;
+}
+
+/**
+ * @brief Gerador do bloco, depende somente da semente e do bloco
+ */
+static SplitMix64 geradorBloco(uint64_t semente, long long bloco) {
+    SplitMix64 semeador(semente * 0xD1B54A32D192ED03ULL ^ (uint64_t)bloco);
+    return SplitMix64(semeador.proximo());
+}
+
+/**
+ * @brief Gera a aresta i
+ *
+ * @param i índice da aresta
+ * @param rng gerador do bloco da aresta
+ * @return Aresta a aresta gerada
+ * @pre i em [0, qnt_arestas)
+ * @post Nenhuma
+ */
+Aresta Gerador::geraAresta(long long i, SplitMix64 &rng) const {
+    long long u = 0, v = 0, horizontais;
+    switch (p.tipo) {
+        case RMAT:
+            // desce escala níveis na matriz de adjacência, escolhendo
+            // um quadrante em cada um
+            for (int k = 0; k < p.escala; k++) {
+                double r = rng.real();
+                u <<= 1;
+                v <<= 1;
+                if (r < p.a) {
+                } else if (r < p.a + p.b) {
+                    v |= 1;
+                } else if (r < p.a + p.b + p.c) {
+                    u |= 1;
+                } else {
+                    u |= 1;
+                    v |= 1;
+                }
+            }
+            u = embaralha(u);
+            v = embaralha(v);
+            break;
+        case ERDOS_RENYI:
+            u = rng.abaixo(p.qnt_nos);
+            do {
+                v = rng.abaixo(p.qnt_nos);
+            } while (v == u);
+            break;
+        case GRADE:
+            horizontais = (long long)p.linhas * (p.colunas - 1);
+            if (i < horizontais) {
+                u = i / (p.colunas - 1) * p.colunas + i % (p.colunas - 1);
+                v = u + 1;
+            } else {
+                u = i - horizontais;
+                v = u + p.colunas;
+            }
+            break;
+        case CADEIA:
+            u = i;
+            v = i + 1;
+            break;
+        case ESTRELA:
+            u = 0;
+            v = i + 1;
+            break;
+    }
+    int peso = p.peso_min + (int)rng.abaixo((uint64_t)((long long)p.peso_max - p.peso_min + 1));
+    return Aresta((int)u, (int)v, peso);
+}
+
+/**
+ * @brief Gera todas as arestas de um bloco
+ *
+ * @param bloco número do bloco
+ * @param arestas vetor onde as arestas do bloco são escritas
+ * @pre arestas com espaço para o bloco
+ * @post Nenhuma
+ */
+void Gerador::geraBloco(long long bloco, Aresta *arestas) const {
+    SplitMix64 rng = geradorBloco(p.semente, bloco);
+    long long ini = bloco * BLOCO_GERADOR;
+    long long fim = std::min(ini + BLOCO_GERADOR, qnt_arestas);
+    for (long long i = ini; i < fim; i++) {
+        arestas[i - ini] = geraAresta(i, rng);
+    }
+}
+
+/**
+ * @brief Escreve um inteiro no buffer, seguido de um separador
+ */
+static char *escreveInteiro(char *pos, int valor, char sep) {
+    pos = std::to_chars(pos, pos + 12, valor).ptr;
+    *pos++ = sep;
+    return pos;
+}
+
+/**
+ * @brief Grava o grafo no formato texto lido por Grafo::ler
+ *
+ * Os blocos são formatados em paralelo e gravados em ordem, sem
+ * guardar todas as arestas na memória
+ * @param filename arquivo de saída
+ * @return true se o arquivo foi escrito
+ * @pre valido
+ * @post Nenhuma
+ */
+bool Gerador::escreveTexto(const std::string &filename) const {
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+    file << "orientado=" << (p.orientado ? "sim" : "nao") << '\n'
+         << "V=" << p.qnt_nos << '\n';
+
+    long long qnt_blocos = (qnt_arestas + BLOCO_GERADOR - 1) / BLOCO_GERADOR;
+    // no máximo 2 blocos por thread formatados ao mesmo tempo
+    int por_vez = 2 * qntThreads();
+    std::vector<std::string> textos(por_vez);
+    for (long long primeiro = 0; primeiro < qnt_blocos; primeiro += por_vez) {
+        int qnt = (int)std::min<long long>(por_vez, qnt_blocos - primeiro);
+        paraleloRoubo(qnt, [&](int, int i) {
+            long long bloco = primeiro + i;
+            SplitMix64 rng = geradorBloco(p.semente, bloco);
+            long long ini = bloco * BLOCO_GERADOR;
+            long long fim = std::min(ini + BLOCO_GERADOR, qnt_arestas);
+            // "(u,v):w\n" tem no máximo 3 inteiros de 11 caracteres e 5 separadores
+            std::string &texto = textos[i];
+            texto.resize((fim - ini) * 38);
+            char *pos = &texto[0];
+            for (long long e = ini; e < fim; e++) {
+                Aresta a = geraAresta(e, rng);
+                *pos++ = '(';
+                pos = escreveInteiro(pos, a.inicio, ',');
+                pos = escreveInteiro(pos, a.fim, ')');
+                *pos++ = ':';
+                pos = escreveInteiro(pos, a.peso, '\n');
+            }
+            texto.resize(pos - texto.data());
+        });
+        for (int i = 0; i < qnt; i++) {
+            file.write(textos[i].data(), textos[i].size());
+        }
+    }
+    return file.good();
+}
+
+/**
+ * @brief Grava o grafo no formato binário (ver GrafoCSR::salvar)
+ *
+ * Todas as arestas ficam na memória para construir o CSR
+ * @param filename arquivo de saída
+ * @return true se o arquivo foi escrito
+ * @pre valido
+ * @post Nenhuma
+ */
+bool Gerador::escreveBinario(const std::string &filename) const {
+    // o formato binário guarda as posições em inteiros de 32 bits
+    long long entradas = p.orientado ? qnt_arestas : 2 * qnt_arestas;
+    if (entradas > INT_MAX) {
+        std::cout << "grafo grande demais para o formato binário, use o texto\n";
+        return false;
+    }
+    std::vector<Aresta> arestas(qnt_arestas);
+    int qnt_blocos = (qnt_arestas + BLOCO_GERADOR - 1) / BLOCO_GERADOR;
+    paraleloRoubo(qnt_blocos, [&](int, int bloco) {
+        geraBloco(bloco, arestas.data() + (long long)bloco * BLOCO_GERADOR);
+    });
+    GrafoCSR csr(arestas, p.qnt_nos, p.orientado, false);
+    return csr.salvar(filename, p.orientado);
+}
@@ -0,0 +1,187 @@
+/**
+ * @file gerador.hpp
+ * @author Victor Emanuel Almeida e Milena Lucas dos Santos
+ * @brief Define a classe Gerador, que cria grafos sintéticos
+ *
+ * @version 0.1
+ * @date 17/10/2026
+ */
+
+#ifndef GERADOR
+#define GERADOR
+
+#include <cstdint>
+#include <string>
+#include "../utils/debug.hpp"
+#include "../grafo/aresta_kruskal.hpp"
+
+/**
+ * @brief Quantidade de arestas geradas por bloco, cada bloco tem a
+ * própria semente, então o resultado não depende da quantidade de threads
+ */
+#define BLOCO_GERADOR (1 << 18)
+
+/**
+ * @brief Quantidade de arestas por vértice do R-MAT quando não é
+ * informada, a mesma do Graph500
+ */
+#define ARESTAS_POR_VERTICE_RMAT 16
+
+/**
+ * @brief Quantidade de arestas por vértice do Erdős–Rényi quando não é
+ * informada
+ */
+#define ARESTAS_POR_VERTICE_ER 8
+
+/**
+ * @brief enumera os tipos de grafo que podem ser gerados
+ */
+enum tipoGrafo {
+    RMAT,  /// R-MAT/Kronecker, graus em lei de potência
+    ERDOS_RENYI,  /// G(n, m), arestas uniformes
+    GRADE,  /// grade 2D, cada vértice ligado ao da direita e ao de baixo
+    CADEIA,  /// caminho 0 - 1 - ... - n-1
+    ESTRELA  /// vértice 0 ligado a todos os outros
+};
+
+/**
+ * @brief Gerador pseudoaleatório splitmix64, rápido e com estado de 64 bits
+ */
+struct SplitMix64 {
+    uint64_t estado;
+
+    SplitMix64(uint64_t semente) : estado(semente) {
+    }
+
+    uint64_t proximo() {
+        uint64_t z = (estado += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    /**
+     * @brief Inteiro em [0, n)
+     */
+    uint64_t abaixo(uint64_t n) {
+        return (uint64_t)(((unsigned __int128)proximo() * n) >> 64);
+    }
+
+    /**
+     * @brief Real em [0, 1)
+     */
+    double real() {
+        return (proximo() >> 11) * 0x1.0p-53;
+    }
+};
+
+/**
+ * @brief Parâmetros de um grafo sintético
+ */
+struct ParametrosGerador {
+    tipoGrafo tipo;
+    long long qnt_nos;  /// ignorado na grade e no R-MAT
+    long long qnt_arestas;  /// somente R-MAT e Erdős–Rényi, 0 para o padrão
+    int escala;  /// R-MAT: 2^escala vértices
+    int linhas, colunas;  /// somente grade
+    uint64_t semente;
+    int peso_min, peso_max;  /// pesos uniformes em [peso_min, peso_max]
+    bool orientado;
+    double a, b, c;  /// probabilidades dos quadrantes do R-MAT, d = 1 - a - b - c
+
+    ParametrosGerador();
+};
+
+/**
+ * @brief Cria grafos sintéticos grandes e reproduzíveis
+ *
+ * As arestas são divididas em blocos de BLOCO_GERADOR, gerados em
+ * paralelo, cada um com um SplitMix64 iniciado a partir da semente e do
+ * número do bloco. A mesma semente sempre gera o mesmo arquivo
+ */
+class Gerador {
+    private:
+    ParametrosGerador p;
+    long long qnt_arestas;  /// quantidade total de arestas
+
+    /**
+     * @brief Embaralha os vértices do R-MAT, para os de grau alto não
+     * ficarem todos no começo
+     *
+     * Multiplicar por um ímpar e somar são bijeções módulo 2^escala
+     */
+    int embaralha(uint64_t v) const;
+
+    /**
+     * @brief Gera a aresta i
+     *
+     * @param i índice da aresta
+     * @param rng gerador do bloco da aresta
+     * @return Aresta a aresta gerada
+     * @pre i em [0, qnt_arestas)
+     * @post Nenhuma
+     */
+    Aresta geraAresta(long long i, SplitMix64 &rng) const;
+
+    /**
+     * @brief Gera todas as arestas de um bloco
+     *
+     * @param bloco número do bloco
+     * @param arestas vetor onde as arestas do bloco são escritas
+     * @pre arestas com espaço para o bloco
+     * @post Nenhuma
+     */
+    void geraBloco(long long bloco, Aresta *arestas) const;
+
+    public:
+    /**
+     * @brief Construtor da classe Gerador
+     *
+     * Calcula a quantidade de vértices e arestas a partir dos parâmetros
+     * @param p parâmetros do grafo
+     * @pre Nenhuma
+     * @post Nenhuma
+     */
+    Gerador(const ParametrosGerador &p);
+
+    /**
+     * @brief Informa se os parâmetros geram um grafo válido
+     *
+     * @param erro recebe o motivo quando os parâmetros são inválidos
+     * @return true se o grafo pode ser gerado
+     */
+    bool valido(std::string &erro) const;
+
+    long long qntNos() const {
+        return p.qnt_nos;
+    }
+
+    long long qntArestas() const {
+        return qnt_arestas;
+    }
+
+    /**
+     * @brief Grava o grafo no formato texto lido por Grafo::ler
+     *
+     * Os blocos são formatados em paralelo e gravados em ordem, sem
+     * guardar todas as arestas na memória
+     * @param filename arquivo de saída
+     * @return true se o arquivo foi escrito
+     * @pre valido
+     * @post Nenhuma
+     */
+    bool escreveTexto(const std::string &filename) const;
+
+    /**
+     * @brief Grava o grafo no formato binário (ver GrafoCSR::salvar)
+     *
+     * Todas as arestas ficam na memória para construir o CSR
+     * @param filename arquivo de saída
+     * @return true se o arquivo foi escrito
+     * @pre valido
+     * @post Nenhuma
+     */
+    bool escreveBinario(const std::string &filename) const;
+};
+
+#endif // GERADOR
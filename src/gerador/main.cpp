@@ -0,0 +1,107 @@
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include "gerador.hpp"
+
+using namespace std;
+
+/**
+ * @brief Mostra como utilizar o gerador
+ */
+static void uso(const char *programa) {
+    cout << "Uso: " << programa << " <tipo> <arquivo> [opções]\n"
+         << "tipos: rmat, erdos-renyi, grade, cadeia, estrela\n"
+         << "opções:\n"
+         << "  --vertices N        quantidade de vértices (padrão 1024)\n"
+         << "  --arestas M         arestas do rmat (padrão 16N) e erdos-renyi (padrão 8N)\n"
+         << "  --escala S          rmat com 2^S vértices\n"
+         << "  --rmat A B C        probabilidades dos quadrantes (padrão 0.57 0.19 0.19)\n"
+         << "  --grade L C         grade com L linhas e C colunas\n"
+         << "  --pesos MIN MAX     pesos uniformes em [MIN, MAX] (padrão 1 100)\n"
+         << "  --semente X         semente do gerador (padrão 1)\n"
+         << "  --nao-orientado     grava orientado=nao\n"
+         << "  --binario           grava no formato binário em vez do texto\n"
+         << "A quantidade de threads pode ser alterada com PAA_THREADS, o\n"
+         << "arquivo gerado é sempre o mesmo para a mesma semente\n";
+}
+
+int main(int argc, char *argv[]) {
+    if (argc < 3) {
+        uso(argv[0]);
+        return 1;
+    }
+    ParametrosGerador p;
+    string tipo = argv[1], saida = argv[2];
+    if (tipo == "rmat") {
+        p.tipo = RMAT;
+    } else if (tipo == "erdos-renyi") {
+        p.tipo = ERDOS_RENYI;
+    } else if (tipo == "grade") {
+        p.tipo = GRADE;
+    } else if (tipo == "cadeia") {
+        p.tipo = CADEIA;
+    } else if (tipo == "estrela") {
+        p.tipo = ESTRELA;
+    } else {
+        cout << "tipo de grafo desconhecido: " << tipo << '\n';
+        uso(argv[0]);
+        return 1;
+    }
+
+    bool binario = false;
+    for (int i = 3; i < argc; i++) {
+        string opcao = argv[i];
+        // quantidade de valores de cada opção
+        int valores = opcao == "--rmat" ? 3
+                    : (opcao == "--grade" || opcao == "--pesos") ? 2
+                    : (opcao == "--nao-orientado" || opcao == "--binario") ? 0 : 1;
+        if (i + valores >= argc) {
+            cout << "valores faltando para " << opcao << '\n';
+            return 1;
+        }
+        if (opcao == "--vertices") {
+            p.qnt_nos = atoll(argv[i + 1]);
+        } else if (opcao == "--arestas") {
+            p.qnt_arestas = atoll(argv[i + 1]);
+        } else if (opcao == "--escala") {
+            p.escala = atoi(argv[i + 1]);
+        } else if (opcao == "--rmat") {
+            p.a = atof(argv[i + 1]);
+            p.b = atof(argv[i + 2]);
+            p.c = atof(argv[i + 3]);
+        } else if (opcao == "--grade") {
+            p.linhas = atoi(argv[i + 1]);
+            p.colunas = atoi(argv[i + 2]);
+        } else if (opcao == "--pesos") {
+            p.peso_min = atoi(argv[i + 1]);
+            p.peso_max = atoi(argv[i + 2]);
+        } else if (opcao == "--semente") {
+            p.semente = strtoull(argv[i + 1], nullptr, 10);
+        } else if (opcao == "--nao-orientado") {
+            p.orientado = false;
+        } else if (opcao == "--binario") {
+            binario = true;
+        } else {
+            cout << "opção desconhecida: " << opcao << '\n';
+            uso(argv[0]);
+            return 1;
+        }
+        i += valores;
+    }
+
+    Gerador gerador(p);
+    string erro;
+    if (!gerador.valido(erro)) {
+        cout << erro << '\n';
+        return 1;
+    }
+    bool ok = binario ? gerador.escreveBinario(saida) : gerador.escreveTexto(saida);
+    if (!ok) {
+        cout << "Não foi possível escrever em " << saida << '\n';
+        return 1;
+    }
+    cout << gerador.qntNos() << " vértices e " << gerador.qntArestas()
+         << " arestas gravados em " << saida << '\n';
+    return 0;
+}
@@ -0,0 +1,460 @@
+/**
+ * @file agm.cpp
+ * @author Victor Emanuel Almeida e Milena Lucas dos Santos
+ * @brief Implementa os algoritmos de Árvore Geradora Mínima da classe Grafo
+ * @version 0.1
+ * @date 17/10/2026
+ */
+
+#include <atomic>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+#include "grafo.hpp"
+#include "conjunto_disjunto.hpp"
+#include "../utils/heap_indexado.hpp"
+#include "../utils/ordenacao.hpp"
+#include "../utils/paralelo.hpp"
+
+/**
+ * @brief Abaixo dessa quantidade de arestas o Filter-Kruskal
+ * simplesmente ordena tudo, como o Kruskal
+ */
+#define MIN_FILTER_KRUSKAL 1024
+
+/**
+ * @brief Ordena as arestas pelo peso e aceita, em ordem, as que ligam
+ * componentes diferentes
+ *
+ * @param v arestas candidatas
+ * @param n quantidade de arestas candidatas
+ * @param conjuntos componentes atuais da floresta
+ * @param arvore vetor que recebe as arestas aceitas
+ * @param qnt_arvore quantidade de arestas já aceitas
+ * @return int quantidade de arestas aceitas, contando as anteriores
+ */
+static int aceitaArestas(Aresta *v, long long n, ConjuntoDisjunto &conjuntos,
+                         Aresta *arvore, int qnt_arvore) {
+    ordenaPorChave(v, n, [](const Aresta &a) { return a.peso; });
+    for (long long i = 0; i < n; i++) {
+        // se os vértices estão em conjuntos diferentes, une os conjuntos
+        if (conjuntos.une(v[i].inicio, v[i].fim)) {
+            arvore[qnt_arvore++] = v[i];
+        }
+    }
+    return qnt_arvore;
+}
+
+/**
+ * @brief Passo recursivo do Filter-Kruskal
+ *
+ * As partições são estáveis, assim arestas de mesmo peso são aceitas
+ * na mesma ordem que no Kruskal
+ */
+static int filterKruskalRec(Aresta *v, long long n, ConjuntoDisjunto &conjuntos,
+                            Aresta *arvore, int qnt_arvore) {
+    if (n <= MIN_FILTER_KRUSKAL) {
+        return aceitaArestas(v, n, conjuntos, arvore, qnt_arvore);
+    }
+
+    // pivô é a mediana de 3 pesos
+    int a = v[0].peso, b = v[n / 2].peso, c = v[n - 1].peso;
+    int pivo = std::max(std::min(a, b), std::min(std::max(a, b), c));
+
+    Aresta *meio = std::stable_partition(v, v + n,
+        [pivo](const Aresta &x) { return x.peso <= pivo; });
+    if (meio == v + n) {
+        // o pivô é o maior peso, então separa os iguais a ele
+        meio = std::stable_partition(v, v + n,
+            [pivo](const Aresta &x) { return x.peso < pivo; });
+        if (meio == v) {
+            // todas as arestas têm o mesmo peso
+            return aceitaArestas(v, n, conjuntos, arvore, qnt_arvore);
+        }
+    }
+
+    qnt_arvore = filterKruskalRec(v, meio - v, conjuntos, arvore, qnt_arvore);
+
+    // descarta as pesadas que ligam vértices já conectados
+    Aresta *fim = std::remove_if(meio, v + n, [&](const Aresta &x) {
+        return conjuntos.acha(x.inicio) == conjuntos.acha(x.fim);
+    });
+    return filterKruskalRec(meio, fim - meio, conjuntos, arvore, qnt_arvore);
+}
+
+/**
+ * @brief Chave de um vértice no heap do Prim: a aresta mais leve que
+ * o liga à árvore
+ *
+ * Comparada por (peso, menor vértice, maior vértice), a mesma ordem
+ * em que o kruskal processa as arestas
+ */
+struct ChavePrim {
+    int peso, a, b;
+
+    bool operator < (const ChavePrim &outra) const {
+        if (peso != outra.peso) {
+            return peso < outra.peso;
+        }
+        if (a != outra.a) {
+            return a < outra.a;
+        }
+        return b < outra.b;
+    }
+};
+
+/**
+ * @brief Junta os vetores de cada thread em um só
+ */
+static void concatena(std::vector<std::vector<int>> &partes,
+                      std::vector<int> &destino) {
+    destino.clear();
+    for (auto &p : partes) {
+        destino.insert(destino.end(), p.begin(), p.end());
+        p.clear();
+    }
+}
+
+/**
+ * @brief Imprime a Árvore Geradora Mínima, peso total e arestas
+ *
+ * @param arvore arestas da árvore, na ordem em que foram aceitas
+ * @param qnt quantidade de arestas da árvore
+ * @pre Nenhuma
+ * @post árvore impressa na saída padrão
+ */
+void Grafo::printAGM(Aresta *arvore, int qnt) {
+    cronometra("impressao");
+    long long peso = 0;
+    for (int i = 0; i < qnt; i++) {
+        peso += arvore[i].peso;
+    }
+    std::cout << "peso total: " << peso << "\narestas: ";
+    if (qnt == 0) {
+        std::cout << "Lista Vazia\n";
+        return;
+    }
+    for (int i = 0; i < qnt; i++) {
+        std::cout << arvore[i] << (i + 1 < qnt ? ' ' : '\n');
+    }
+}
+
+/**
+ * @brief Executa o algoritmo de Kruskal
+ *
+ * Algoritmo que obtém a "Árvore Geradora Mínima",
+ * sempre adicionando arestas de menor peso. Os componentes
+ * são mantidos em um ConjuntoDisjunto
+ * @pre Grafo carregado
+ * @post Nenhuma
+ */
+void Grafo::kruskal() {
+    cronometra("calculo.agm");
+    Aresta *arestas, *arvore;
+    ConjuntoDisjunto conjuntos(qnt_nos);
+    int i, c, qnt;
+    arestas = new Aresta[this->qntArestas()];
+    arvore = new Aresta[qnt_nos];
+    // inserindo todas as arestas para ordenar
+    debug("\narestas de E\n");
+    c = extraiArestas(arestas);
+
+    qnt = aceitaArestas(arestas, c, conjuntos, arvore, 0);
+
+    debug("arestas ordenadas em ordem nao decrescente\n");
+    for(i = 0; i < c; i++) {
+        debug(arestas[i] << std::endl);
+    }
+
+    printAGM(arvore, qnt);
+    delete[] arestas;
+    delete[] arvore;
+}
+
+/**
+ * @brief Executa o algoritmo Filter-Kruskal
+ *
+ * Variante do Kruskal que divide as arestas pelo peso de um pivô,
+ * processa primeiro as leves e descarta as pesadas que ligam vértices
+ * já conectados antes de ordená-las. Resultado idêntico ao kruskal
+ * @pre Grafo carregado
+ * @post Nenhuma
+ */
+void Grafo::filterKruskal() {
+    cronometra("calculo.agm");
+    Aresta *arestas, *arvore;
+    ConjuntoDisjunto conjuntos(qnt_nos);
+    int c, qnt;
+    arestas = new Aresta[this->qntArestas()];
+    arvore = new Aresta[qnt_nos];
+    c = extraiArestas(arestas);
+
+    qnt = filterKruskalRec(arestas, c, conjuntos, arvore, 0);
+
+    printAGM(arvore, qnt);
+    delete[] arestas;
+    delete[] arvore;
+}
+
+/**
+ * @brief Executa o algoritmo de Borůvka, em paralelo
+ *
+ * A cada rodada todas as threads escolhem a aresta mais leve que sai
+ * de cada componente, e os componentes ligados por elas são contraídos.
+ * Empates de peso são desfeitos pela ordem (início, fim), assim o
+ * resultado é idêntico ao kruskal
+ * @pre Grafo carregado
+ * @post Nenhuma
+ */
+void Grafo::boruvka() {
+    cronometra("calculo.agm");
+    int i, c, qnt;
+    int t = qntThreads();
+    Aresta *arestas = new Aresta[this->qntArestas()];
+    c = extraiArestas(arestas);
+
+    // o índice da aresta no vetor (ordenado por início e fim) desempata
+    auto maisLeve = [arestas](int e, int f) {
+        return f == NIL || arestas[e].peso < arestas[f].peso ||
+               (arestas[e].peso == arestas[f].peso && e < f);
+    };
+
+    // rotulo[v] é o componente de v, identificado por um dos seus vértices
+    int *rotulo = new int[qnt_nos];
+    int *pai = new int[qnt_nos];
+    std::atomic<int> *melhor = new std::atomic<int>[qnt_nos];
+    for (i = 0; i < qnt_nos; i++) {
+        rotulo[i] = pai[i] = i;
+        melhor[i].store(NIL, std::memory_order_relaxed);
+    }
+
+    std::vector<int> ativas(c), componentes(qnt_nos), escolhidas, avos;
+    std::iota(ativas.begin(), ativas.end(), 0);
+    std::iota(componentes.begin(), componentes.end(), 0);
+    std::vector<std::vector<int>> locais(t), locais_arvore(t);
+
+    while (!ativas.empty()) {
+        // cada componente escolhe a aresta mais leve que sai dele
+        paraleloPara(ativas.size(), [&](int, long long ini, long long fim) {
+            for (long long k = ini; k < fim; k++) {
+                int e = ativas[k];
+                for (int comp : {rotulo[arestas[e].inicio],
+                                 rotulo[arestas[e].fim]}) {
+                    int atual = melhor[comp].load(std::memory_order_relaxed);
+                    while (maisLeve(e, atual) &&
+                           !melhor[comp].compare_exchange_weak(atual, e,
+                                std::memory_order_relaxed)) {
+                    }
+                }
+            }
+        });
+
+        // liga cada componente ao da outra ponta da sua aresta; quando 2
+        // componentes escolhem a mesma aresta, o de menor rótulo vira raiz
+        // e somente ele guarda a aresta na árvore
+        paraleloPara(componentes.size(), [&](int id, long long ini, long long fim) {
+            for (long long k = ini; k < fim; k++) {
+                int comp = componentes[k];
+                int e = melhor[comp].load(std::memory_order_relaxed);
+                if (e == NIL) {
+                    continue;
+                }
+                int outro = rotulo[arestas[e].inicio];
+                if (outro == comp) {
+                    outro = rotulo[arestas[e].fim];
+                }
+                if (melhor[outro].load(std::memory_order_relaxed) == e &&
+                    comp < outro) {
+                    locais_arvore[id].push_back(e);
+                } else if (melhor[outro].load(std::memory_order_relaxed) != e) {
+                    pai[comp] = outro;
+                    locais_arvore[id].push_back(e);
+                } else {
+                    pai[comp] = outro;
+                }
+            }
+        });
+        for (auto &l : locais_arvore) {
+            escolhidas.insert(escolhidas.end(), l.begin(), l.end());
+            l.clear();
+        }
+
+        // salto de ponteiros até todo componente apontar para a raiz,
+        // primeiro todos leem os avôs e depois todos escrevem
+        bool mudou = true;
+        while (mudou) {
+            std::atomic<bool> algum(false);
+            avos.resize(componentes.size());
+            paraleloPara(componentes.size(), [&](int, long long ini, long long fim) {
+                bool local = false;
+                for (long long k = ini; k < fim; k++) {
+                    int comp = componentes[k];
+                    avos[k] = pai[pai[comp]];
+                    local = local || (avos[k] != pai[comp]);
+                }
+                if (local) {
+                    algum.store(true, std::memory_order_relaxed);
+                }
+            });
+            paraleloPara(componentes.size(), [&](int, long long ini, long long fim) {
+                for (long long k = ini; k < fim; k++) {
+                    pai[componentes[k]] = avos[k];
+                }
+            });
+            mudou = algum.load();
+        }
+
+        // contração: novo rótulo dos vértices, componentes que sobraram
+        // e arestas que ainda ligam componentes diferentes
+        paraleloPara(qnt_nos, [&](int, long long ini, long long fim) {
+            for (long long v = ini; v < fim; v++) {
+                rotulo[v] = pai[rotulo[v]];
+            }
+        });
+        paraleloPara(componentes.size(), [&](int id, long long ini, long long fim) {
+            for (long long k = ini; k < fim; k++) {
+                int comp = componentes[k];
+                melhor[comp].store(NIL, std::memory_order_relaxed);
+                if (pai[comp] == comp) {
+                    locais[id].push_back(comp);
+                }
+            }
+        });
+        concatena(locais, componentes);
+        paraleloPara(ativas.size(), [&](int id, long long ini, long long fim) {
+            for (long long k = ini; k < fim; k++) {
+                int e = ativas[k];
+                if (rotulo[arestas[e].inicio] != rotulo[arestas[e].fim]) {
+                    locais[id].push_back(e);
+                }
+            }
+        });
+        concatena(locais, ativas);
+    }
+
+    // mesma ordem em que o kruskal aceitaria as arestas
+    std::sort(escolhidas.begin(), escolhidas.end(), maisLeve);
+    qnt = escolhidas.size();
+    Aresta *arvore = new Aresta[qnt];
+    for (i = 0; i < qnt; i++) {
+        arvore[i] = arestas[escolhidas[i]];
+    }
+    printAGM(arvore, qnt);
+
+    delete[] arvore;
+    delete[] melhor;
+    delete[] pai;
+    delete[] rotulo;
+    delete[] arestas;
+}
+
+/**
+ * @brief Executa o algoritmo de Prim, com um heap 4-ário indexado
+ *
+ * Cresce uma árvore a partir de cada vértice ainda não alcançado,
+ * formando a floresta geradora mínima. Empates de peso são desfeitos
+ * pelos vértices da aresta, assim o resultado é idêntico ao kruskal
+ * @return true se a árvore foi calculada
+ * @return false se o grafo é orientado
+ * @pre Grafo carregado
+ * @post Nenhuma
+ */
+bool Grafo::prim() {
+    if (isOrientado) {
+        std::cout << "Grafo orientado, algoritmo não atende ao requisito\n";
+        return false;
+    }
+    cronometra("calculo.agm");
+    int i, qnt = 0;
+    HeapIndexado<ChavePrim> heap(qnt_nos);
+    bool *na_arvore = new bool[qnt_nos];
+    Aresta *arvore = new Aresta[qnt_nos];
+    for (i = 0; i < qnt_nos; i++) {
+        na_arvore[i] = false;
+    }
+
+    for (int raiz = 0; raiz < qnt_nos; raiz++) {
+        if (na_arvore[raiz]) {
+            continue;
+        }
+        heap.insere(raiz, ChavePrim{0, NIL, NIL});
+        while (!heap.isVazio()) {
+            int u = heap.retiraMinimo();
+            na_arvore[u] = true;
+            if (u != raiz) {
+                const ChavePrim &c = heap.chave(u);
+                arvore[qnt++] = Aresta(c.a, c.b, c.peso);
+            }
+            conta(ARESTAS_VISITADAS, grafo->grau(u));
+            for (int e = grafo->inicio(u); e < grafo->fim(u); e++) {
+                int v = grafo->destino(e);
+                if (na_arvore[v]) {
+                    continue;
+                }
+                ChavePrim nova{grafo->peso(e), std::min(u, v), std::max(u, v)};
+                if (!heap.contem(v)) {
+                    heap.insere(v, nova);
+                } else if (nova < heap.chave(v)) {
+                    heap.diminui(v, nova);
+                }
+            }
+        }
+    }
+
+    // mesma ordem em que o kruskal aceitaria as arestas
+    std::sort(arvore, arvore + qnt, [](const Aresta &x, const Aresta &y) {
+        return ChavePrim{x.peso, x.inicio, x.fim} <
+               ChavePrim{y.peso, y.inicio, y.fim};
+    });
+    printAGM(arvore, qnt);
+
+    delete[] arvore;
+    delete[] na_arvore;
+    return true;
+}
+
+/**
+ * @brief Escolhe o algoritmo de Árvore Geradora Mínima mais rápido
+ * para o grafo, pela densidade
+ *
+ * Grafos não orientados densos (E >= V log V) usam o Prim, que não
+ * precisa ordenar todas as arestas, os demais usam o Kruskal
+ * @return motorAGM PRIM ou KRUSKAL
+ * @pre Grafo carregado
+ * @post Nenhuma
+ */
+motorAGM Grafo::escolheMotorAGM() {
+    if (!isOrientado && qntArestas() >= qnt_nos * std::log2(qnt_nos + 1)) {
+        return PRIM;
+    }
+    return KRUSKAL;
+}
+
+/**
+ * @brief Calcula a Árvore Geradora Mínima com o algoritmo escolhido
+ *
+ * @param motor algoritmo a ser utilizado, AGM_AUTOMATICO usa
+ * escolheMotorAGM
+ * @pre Grafo carregado
+ * @post Nenhuma
+ */
+void Grafo::arvoreGeradoraMinima(motorAGM motor) {
+    switch (motor) {
+        case KRUSKAL:
+            kruskal();
+            break;
+        case FILTER_KRUSKAL:
+            filterKruskal();
+            break;
+        case BORUVKA:
+            boruvka();
+            break;
+        case PRIM:
+            prim();
+            break;
+        case AGM_AUTOMATICO:
+            arvoreGeradoraMinima(escolheMotorAGM());
+            break;
+    }
+}
@@ -0,0 +1,426 @@
+/**
+ * @file busca_largura.cpp
+ * @author Victor Emanuel Almeida e Milena Lucas dos Santos
+ * @brief Implementa os algoritmos de busca em largura da classe Grafo
+ * @version 0.1
+ * @date 17/10/2026
+ */
+
+#include <atomic>
+#include <charconv>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "grafo.hpp"
+#include "../utils/arquivo_mapeado.hpp"
+#include "../utils/bitmap.hpp"
+#include "../utils/paralelo.hpp"
+
+/**
+ * @brief Listas das arestas que chegam em cada vértice
+ *
+ * No grafo não orientado é o próprio grafo, no orientado o transposto
+ * é criado na primeira chamada e guardado
+ * @return const GrafoCSR& arestas invertidas
+ * @pre Grafo carregado
+ * @post Nenhuma
+ */
+const GrafoCSR &Grafo::entradas() {
+    if (!isOrientado) {
+        return *grafo;
+    }
+    if (transposto == nullptr) {
+        transposto = grafo->transposto();
+    }
+    return *transposto;
+}
+
+/**
+ * @brief Calcula dist, predecessores e ordem da busca em largura
+ * com uma fila
+ *
+ * @param origem vértice de origem
+ * @pre dist, predecessores e ordem alocados
+ * @post dist, predecessores e ordem preenchidos
+ */
+void Grafo::calculaBuscaFila(int origem) {
+    for (int i = 0; i < qnt_nos; i++) {
+        predecessores[i] = NIL;
+        dist[i] = MAX_DIST;
+    }
+    dist[origem] = 0;
+    ordem[qnt_ordem++] = origem;
+
+    // cada vértice entra uma única vez, na mesma ordem da visita,
+    // assim o próprio vetor ordem é a fila
+    for (int cabeca = 0; cabeca < qnt_ordem; cabeca++) {
+        int u = ordem[cabeca];
+        conta(ARESTAS_VISITADAS, grafo->grau(u));
+        for (int e = grafo->inicio(u); e < grafo->fim(u); e++) {
+            int v = grafo->destino(e);
+            if (dist[v] == MAX_DIST) {
+                dist[v] = dist[u] + 1;
+                predecessores[v] = u;
+                ordem[qnt_ordem++] = v;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Calcula dist, predecessores e ordem da busca em largura
+ * com direção otimizada
+ *
+ * Cada nível é expandido de cima para baixo (a fronteira procura os
+ * vizinhos não visitados) ou de baixo para cima (cada vértice não
+ * visitado procura um vizinho na fronteira), com a heurística de
+ * Beamer (ver ALFA_DIRECAO e BETA_DIRECAO). De cima para baixo a
+ * fronteira é o trecho do nível em ordem, de baixo para cima ela é
+ * marcada em um bitmap. Cada nível fica em ordem crescente e o
+ * predecessor é o menor vizinho do nível anterior, nas 2 direções.
+ * As distâncias são idênticas às da calculaBuscaFila
+ * @param origem vértice de origem
+ * @pre dist, predecessores e ordem alocados
+ * @post dist, predecessores e ordem preenchidos
+ */
+void Grafo::calculaBuscaDirecaoOtimizada(int origem) {
+    Bitmap fronteira(qnt_nos), visitado(qnt_nos);
+    for (int i = 0; i < qnt_nos; i++) {
+        predecessores[i] = NIL;
+        dist[i] = MAX_DIST;
+    }
+    dist[origem] = 0;
+    ordem[qnt_ordem++] = origem;
+    visitado.marca(origem);
+
+    long long arestas_fronteira = grafo->grau(origem);
+    long long arestas_restantes = grafo->qntEntradas() - arestas_fronteira;
+    int tam_anterior = 0;
+    bool baixo_cima = false;
+
+    // o nível atual é ordem[inicio, fim)
+    for (int inicio = 0, nivel = 1; inicio < qnt_ordem; nivel++) {
+        int fim = qnt_ordem;
+        int tam_fronteira = fim - inicio;
+        if (!baixo_cima) {
+            baixo_cima = arestas_fronteira > arestas_restantes / ALFA_DIRECAO;
+        } else {
+            baixo_cima = !(tam_fronteira < tam_anterior &&
+                           tam_fronteira < qnt_nos / BETA_DIRECAO);
+        }
+
+        if (baixo_cima) {
+            const GrafoCSR &g = entradas();
+            for (int k = inicio; k < fim; k++) {
+                fronteira.marca(ordem[k]);
+            }
+            for (int k = 0; k < visitado.qntPalavras(); k++) {
+                for (uint64_t w = ~visitado.palavra(k); w; w &= w - 1) {
+                    int v = k * 64 + __builtin_ctzll(w);
+                    if (v >= qnt_nos) {
+                        break;
+                    }
+                    for (int e = g.inicio(v); e < g.fim(v); e++) {
+                        conta(ARESTAS_VISITADAS, 1);
+                        if (fronteira.testa(g.destino(e))) {
+                            predecessores[v] = g.destino(e);
+                            ordem[qnt_ordem++] = v;
+                            break;
+                        }
+                    }
+                }
+            }
+            for (int k = inicio; k < fim; k++) {
+                fronteira.desmarca(ordem[k]);
+            }
+        } else {
+            for (int k = inicio; k < fim; k++) {
+                int u = ordem[k];
+                conta(ARESTAS_VISITADAS, grafo->grau(u));
+                for (int e = grafo->inicio(u); e < grafo->fim(u); e++) {
+                    int v = grafo->destino(e);
+                    if (!visitado.testa(v)) {
+                        visitado.marca(v);
+                        predecessores[v] = u;
+                        ordem[qnt_ordem++] = v;
+                    }
+                }
+            }
+            std::sort(ordem + fim, ordem + qnt_ordem);
+        }
+
+        arestas_fronteira = 0;
+        for (int k = fim; k < qnt_ordem; k++) {
+            int v = ordem[k];
+            visitado.marca(v);
+            dist[v] = nivel;
+            arestas_fronteira += grafo->grau(v);
+        }
+        arestas_restantes -= arestas_fronteira;
+        tam_anterior = tam_fronteira;
+        inicio = fim;
+    }
+}
+
+/**
+ * @brief Calcula dist, predecessores e ordem da busca em largura
+ * em paralelo, um nível por vez
+ *
+ * A fronteira é dividida entre as threads, cada uma guarda os
+ * vértices descobertos em um vetor próprio e o predecessor é marcado
+ * com compare-and-swap, assim cada vértice é descoberto uma única
+ * vez. Os vetores são então copiados em paralelo para o final de
+ * ordem, que é a próxima fronteira. As distâncias são idênticas às da
+ * calculaBuscaFila, a ordem dentro de cada nível e o predecessor
+ * dependem das threads, mas sempre formam uma árvore de busca em
+ * largura
+ * @param origem vértice de origem
+ * @pre dist, predecessores e ordem alocados
+ * @post dist, predecessores e ordem preenchidos
+ */
+void Grafo::calculaBuscaParalela(int origem) {
+    int t = qntThreads();
+    // predecessor de cada vértice, a origem é o seu próprio predecessor
+    // para não ser descoberta novamente
+    std::atomic<int> *pai = new std::atomic<int>[qnt_nos];
+    std::vector<std::vector<int>> descobertos(t);
+    std::vector<long long> posicao(t + 1);
+
+    paraleloPara(qnt_nos, [&](int, long long ini, long long fim) {
+        for (long long i = ini; i < fim; i++) {
+            pai[i].store(NIL, std::memory_order_relaxed);
+            dist[i] = MAX_DIST;
+        }
+    });
+    pai[origem].store(origem);
+    dist[origem] = 0;
+    ordem[qnt_ordem++] = origem;
+
+    // a fronteira atual é ordem[inicio, qnt_ordem)
+    for (int inicio = 0, nivel = 1; inicio < qnt_ordem; nivel++) {
+        int fim = qnt_ordem;
+        for (auto &local : descobertos) {
+            local.clear();
+        }
+        paraleloPara(fim - inicio, [&](int id, long long ini, long long lim) {
+            std::vector<int> &local = descobertos[id];
+            for (long long k = inicio + ini; k < inicio + lim; k++) {
+                int u = ordem[k];
+                conta(ARESTAS_VISITADAS, grafo->grau(u));
+                for (int e = grafo->inicio(u); e < grafo->fim(u); e++) {
+                    int v = grafo->destino(e);
+                    int esperado = NIL;
+                    if (pai[v].load(std::memory_order_relaxed) == NIL &&
+                        pai[v].compare_exchange_strong(esperado, u,
+                            std::memory_order_relaxed)) {
+                        dist[v] = nivel;
+                        local.push_back(v);
+                    }
+                }
+            }
+        });
+
+        posicao[0] = fim;
+        for (int id = 0; id < t; id++) {
+            posicao[id + 1] = posicao[id] + descobertos[id].size();
+        }
+        paraleloPara(t, [&](int, long long ini, long long lim) {
+            for (long long id = ini; id < lim; id++) {
+                std::copy(descobertos[id].begin(), descobertos[id].end(),
+                          ordem + posicao[id]);
+            }
+        });
+        inicio = fim;
+        qnt_ordem = posicao[t];
+    }
+
+    paraleloPara(qnt_nos, [&](int, long long ini, long long fim) {
+        for (long long i = ini; i < fim; i++) {
+            predecessores[i] = pai[i].load(std::memory_order_relaxed);
+        }
+    });
+    predecessores[origem] = NIL;
+    delete[] pai;
+}
+
+/**
+ * @brief Cria arvore_busca com a árvore da busca em largura a partir
+ * da origem, caso a última não tenha sido a partir dela
+ *
+ * @param origem vértice de origem
+ * @pre Grafo carregado
+ * @post arvore_busca com raiz na origem
+ */
+void Grafo::preparaArvoreBusca(int origem) {
+    if (arvore_busca != nullptr && arvore_busca->getRaiz() == origem) {
+        return;
+    }
+    cronometra("calculo.bfs");
+    predecessores = new int[qnt_nos];
+    dist          = new int[qnt_nos];
+    ordem         = new int[qnt_nos];
+    qnt_ordem     = 0;
+    if (escolheMotorBusca() == BUSCA_DIRECAO_OTIMIZADA) {
+        calculaBuscaDirecaoOtimizada(origem);
+    } else {
+        calculaBuscaFila(origem);
+    }
+    conta(VERTICES_ENFILEIRADOS, qnt_ordem);
+    delete arvore_busca;
+    arvore_busca = new IndiceLCA(predecessores, qnt_nos, origem);
+    delete[] predecessores;
+    delete[] dist;
+    delete[] ordem;
+}
+
+/**
+ * @brief Primeiro antecessor comum de u e v na árvore da busca em
+ * largura, sem contar os próprios vértices
+ *
+ * É o menor ancestral comum, ou o predecessor dele quando ele é u ou v
+ * @param u vértice
+ * @param v vértice
+ * @return int o antecessor comum, ou NIL caso não exista
+ * @pre arvore_busca criada
+ * @post Nenhuma
+ */
+int Grafo::primeiroAntecessorComum(int u, int v) {
+    int l = arvore_busca->lca(u, v);
+    if (l != NIL && (l == u || l == v)) {
+        return arvore_busca->getPai(l);
+    }
+    return l;
+}
+
+/**
+ * @brief Mostra na tela a profundidade de u e v e o primeiro antecessor
+ * comum dos 2 na árvore da última busca em largura
+ *
+ * @param u vértice
+ * @param v vértice
+ * @pre buscaEmLargura executada
+ * @post Nenhuma
+ */
+void Grafo::antecessorComum(int u, int v) {
+    if (arvore_busca == nullptr || u < 0 || u >= qnt_nos || v < 0 ||
+        v >= qnt_nos || !arvore_busca->contem(u) || !arvore_busca->contem(v)) {
+        std::cout << "não tem caminhos\n";
+        return;
+    }
+    std::cout << "Grau o vértice " << u <<  " = " << arvore_busca->profundidade(u) << '\n';
+    std::cout << "Grau o vértice " << v <<  " = " << arvore_busca->profundidade(v) << '\n';
+
+    std::cout << "Primeiro antecessor comum = " << primeiroAntecessorComum(u, v) << '\n';
+}
+
+/**
+ * @brief Escreve um inteiro seguido de um separador
+ */
+static void escreveInteiro(std::string &buf, int valor, char sep) {
+    char tmp[16];
+    char *fim = std::to_chars(tmp, tmp + sizeof(tmp), valor).ptr;
+    *fim++ = sep;
+    buf.append(tmp, fim);
+}
+
+/**
+ * @brief Responde consultas de menor ancestral comum em lote, na
+ * árvore da busca em largura a partir da origem
+ *
+ * O arquivo de entrada tem um par "u v" por linha, para cada um é
+ * gravada a linha "u v lca profundidade_u profundidade_v", com -1
+ * para vértices fora da árvore. As consultas são respondidas em
+ * paralelo, em blocos de BLOCO_CONSULTAS
+ * @param origem raiz da árvore
+ * @param entrada arquivo com as consultas
+ * @param saida arquivo onde as respostas são gravadas
+ * @return true se todas as consultas foram respondidas
+ * @return false caso algum arquivo não possa ser aberto
+ * @pre Grafo carregado, origem contida no Grafo
+ * @post Nenhuma
+ */
+bool Grafo::ancestraisEmLote(int origem, const std::string &entrada,
+                             const std::string &saida) {
+    ArquivoMapeado arquivo;
+    if (!arquivo.abre(entrada)) {
+        return false;
+    }
+    std::ofstream file(saida, std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+    cronometra("calculo.ancestrais");
+    preparaArvoreBusca(origem);
+    arvore_busca->prepara();
+
+    // pares lidos do texto, linhas sem 2 inteiros são ignoradas
+    std::vector<int> pares;
+    const char *p = arquivo.inicio(), *fim = arquivo.fim();
+    while (p < fim) {
+        const char *fim_linha = (const char*)memchr(p, '\n', fim - p);
+        if (!fim_linha) {
+            fim_linha = fim;
+        }
+        int par[2], lidos = 0;
+        while (lidos < 2 && p < fim_linha) {
+            while (p < fim_linha && *p != '-' && (*p < '0' || *p > '9')) {
+                p++;
+            }
+            auto res = std::from_chars(p, fim_linha, par[lidos]);
+            if (res.ec != std::errc()) {
+                break;
+            }
+            p = res.ptr;
+            lidos++;
+        }
+        if (lidos == 2) {
+            pares.push_back(par[0]);
+            pares.push_back(par[1]);
+        }
+        p = fim_linha + 1;
+    }
+
+    long long qnt = pares.size() / 2;
+    std::vector<std::string> buffers(qntThreads());
+    for (long long ini = 0; ini < qnt && file.good(); ini += BLOCO_CONSULTAS) {
+        long long tam = std::min<long long>(BLOCO_CONSULTAS, qnt - ini);
+        for (auto &buf : buffers) {
+            buf.clear();
+        }
+        paraleloPara(tam, [&](int id, long long a, long long b) {
+            std::string &buf = buffers[id];
+            for (long long i = ini + a; i < ini + b; i++) {
+                int u = pares[2 * i], v = pares[2 * i + 1];
+                bool valido = u >= 0 && u < qnt_nos && v >= 0 && v < qnt_nos;
+                escreveInteiro(buf, u, ' ');
+                escreveInteiro(buf, v, ' ');
+                escreveInteiro(buf, valido ? arvore_busca->lca(u, v) : NIL, ' ');
+                escreveInteiro(buf, valido ? arvore_busca->profundidade(u) : -1, ' ');
+                escreveInteiro(buf, valido ? arvore_busca->profundidade(v) : -1, '\n');
+            }
+        });
+        for (auto &buf : buffers) {
+            file.write(buf.data(), buf.size());
+        }
+    }
+    return file.good();
+}
+
+/**
+ * @brief Escolhe o algoritmo de busca em largura mais rápido para
+ * o grafo
+ *
+ * A direção otimizada somente compensa em grafos grandes
+ * @return motorBusca BUSCA_DIRECAO_OTIMIZADA ou BUSCA_FILA
+ * @pre Grafo carregado
+ * @post Nenhuma
+ */
+motorBusca Grafo::escolheMotorBusca() {
+    if (grafo->qntEntradas() >= MIN_DIRECAO_OTIMIZADA) {
+        return BUSCA_DIRECAO_OTIMIZADA;
+    }
+    return BUSCA_FILA;
+}
@@ -0,0 +1,835 @@
+/**
+ * @file caminhos.cpp
+ * @author Victor Emanuel Almeida e Milena Lucas dos Santos
+ * @brief Implementa os algoritmos de menor caminho da classe Grafo
+ * @version 0.1
+ * @date 17/10/2026
+ */
+
+#include <atomic>
+#include <climits>
+#include <cstring>
+#include <vector>
+
+#include "grafo.hpp"
+#include "../utils/distancia_atomica.hpp"
+#include "../utils/heap_radix.hpp"
+#include "../utils/paralelo.hpp"
+
+/**
+ * @brief Distância dos vértices não alcançados no dijkstraCSR
+ */
+#define INF_DIJKSTRA LLONG_MAX
+
+/**
+ * @brief Algoritmo de Dijkstra sobre o CSR
+ *
+ * Não usa nenhum atributo do Grafo, assim várias threads podem executá-lo
+ * ao mesmo tempo, cada uma com seus vetores e seu heap
+ * @param g grafo
+ * @param peso função peso(u, e) que retorna o peso da entrada e, que sai
+ * de u, não negativo
+ * @param origem vértice de origem
+ * @param d distâncias, INF_DIJKSTRA nos não alcançados
+ * @param pred predecessores
+ * @param heap heap vazio
+ */
+template<class P> static void dijkstraCSR(const GrafoCSR &g, P peso, int origem,
+                                          long long *d, int *pred,
+                                          HeapRadix &heap) {
+    for (int i = 0; i < g.qntNos(); i++) {
+        d[i] = INF_DIJKSTRA;
+        pred[i] = NIL;
+    }
+    d[origem] = 0;
+    heap.limpar();
+    heap.insere(0, origem);
+    while (!heap.isVazio()) {
+        auto x = heap.retiraMinimo();
+        int u = x.second;
+        // entrada antiga, o vértice já foi retirado com distância menor
+        if ((long long)x.first != d[u]) {
+            continue;
+        }
+        conta(ARESTAS_VISITADAS, g.grau(u));
+        for (int e = g.inicio(u); e < g.fim(u); e++) {
+            int v = g.destino(e);
+            long long nova = d[u] + peso(u, e);
+            if (nova < d[v]) {
+                conta(RELAXACOES, 1);
+                d[v] = nova;
+                pred[v] = u;
+                heap.insere(nova, v);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Calcula dist e predecessores com o algoritmo de Bellman-Ford
+ *
+ * Faz no máximo qnt_nos - 1 passadas por todas as arestas,
+ * parando antes caso uma passada não altere nada
+ * @param origem vértice de origem
+ * @return true Caso não exista ciclo negativo alcançável da origem
+ * @return false Caso exista ciclo negativo alcançável da origem
+ * @pre dist e predecessores alocados
+ * @post dist e predecessores preenchidos
+ */
+bool Grafo::calculaBellmanFord(int origem) {
+    inicializaOrigem(origem);
+    return passadasBellmanFord();
+}
+
+/**
+ * @brief Passadas do Bellman-Ford a partir dos valores atuais de dist
+ *
+ * Faz no máximo qnt_nos - 1 passadas por todas as arestas,
+ * parando antes caso uma passada não altere nada, e depois procura
+ * um ciclo negativo
+ * @return true Caso não exista ciclo negativo alcançável
+ * @return false Caso exista ciclo negativo alcançável
+ * @pre dist e predecessores inicializados
+ * @post dist e predecessores preenchidos
+ */
+bool Grafo::passadasBellmanFord() {
+    int i, qnt;
+    bool ret;
+
+    for (qnt = 0; qnt < (qnt_nos - 1); qnt++) {
+        ret = false;
+        conta(PASSADAS_BELLMAN_FORD, 1);
+        conta(ARESTAS_VISITADAS, grafo->qntEntradas());
+        // percorre cada uma das arestas
+        for(i = 0; i < qnt_nos; i++) {
+            for(int e = grafo->inicio(i); e < grafo->fim(i); e++) {
+                if (relax(i, grafo->destino(e), grafo->peso(e))) {
+                    ret = true;
+                }
+            }
+        }
+        // se não teve nenhum relax nessa interação por todas as arestas
+        // pare de executar o algoritmo
+        if (!ret) {
+            return true;
+        }
+    }
+
+    // percorre cada uma das arestas, buscando ciclo negativo
+    for(i = 0; i < qnt_nos; i++) {
+        if (dist[i] == MAX_DIST) {
+            continue;
+        }
+        for (int e = grafo->inicio(i); e < grafo->fim(i); e++) {
+            if (dist[grafo->destino(e)] > dist[i] + grafo->peso(e)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Calcula dist e predecessores com o Bellman-Ford baseado
+ * em fila (SPFA)
+ *
+ * Somente as arestas dos vértices cuja distância mudou são relaxadas.
+ * Utiliza as heurísticas SLF (vértice com distância menor que o início
+ * da fila entra no início) e LLL (vértice com distância maior que a
+ * média da fila vai para o fim). Cada vértice guarda quantas arestas
+ * tem o seu caminho atual, um caminho com qnt_nos arestas indica um
+ * ciclo negativo
+ * @param origem vértice de origem
+ * @return true Caso não exista ciclo negativo alcançável da origem
+ * @return false Caso exista ciclo negativo alcançável da origem
+ * @pre dist e predecessores alocados
+ * @post dist e predecessores preenchidos
+ */
+bool Grafo::calculaBellmanFordFila(int origem) {
+    // fila circular, cada vértice está no máximo uma vez na fila
+    int *fila = new int[qnt_nos];
+    int *arestas_caminho = new int[qnt_nos];
+    bool *na_fila = new bool[qnt_nos];
+    int cabeca = 0, tam = 0;
+    long long soma = 0;  // soma das distâncias dos vértices na fila
+    bool ret = true;
+
+    inicializaOrigem(origem);
+    for (int i = 0; i < qnt_nos; i++) {
+        na_fila[i] = false;
+        arestas_caminho[i] = 0;
+    }
+    fila[0] = origem;
+    na_fila[origem] = true;
+    tam = 1;
+
+    while (tam > 0 && ret) {
+        // LLL: manda para o fim os vértices acima da média
+        while (tam > 1 && (long long)dist[fila[cabeca]] * tam > soma) {
+            fila[(cabeca + tam) % qnt_nos] = fila[cabeca];
+            cabeca = (cabeca + 1) % qnt_nos;
+        }
+        int u = fila[cabeca];
+        cabeca = (cabeca + 1) % qnt_nos;
+        tam--;
+        soma -= dist[u];
+        na_fila[u] = false;
+        conta(ARESTAS_VISITADAS, grafo->grau(u));
+
+        for (int e = grafo->inicio(u); e < grafo->fim(u); e++) {
+            int v = grafo->destino(e);
+            int antiga = dist[v];
+            if (!relax(u, v, grafo->peso(e))) {
+                continue;
+            }
+            arestas_caminho[v] = arestas_caminho[u] + 1;
+            if (arestas_caminho[v] >= qnt_nos) {
+                ret = false;
+                break;
+            }
+            if (na_fila[v]) {
+                soma += dist[v] - antiga;
+                continue;
+            }
+            // SLF: distância menor que a do início da fila entra no início
+            if (tam > 0 && dist[v] < dist[fila[cabeca]]) {
+                cabeca = (cabeca + qnt_nos - 1) % qnt_nos;
+                fila[cabeca] = v;
+            } else {
+                fila[(cabeca + tam) % qnt_nos] = v;
+            }
+            tam++;
+            soma += dist[v];
+            na_fila[v] = true;
+        }
+    }
+
+    delete[] fila;
+    delete[] arestas_caminho;
+    delete[] na_fila;
+    return ret;
+}
+
+/**
+ * @brief Calcula dist e predecessores com o algoritmo de Dijkstra,
+ * usando um HeapRadix
+ *
+ * @param origem vértice de origem
+ * @pre dist e predecessores alocados, nenhum peso negativo
+ * @post dist e predecessores preenchidos, distâncias a partir de
+ * MAX_DIST limitadas a MAX_DIST - 1
+ */
+void Grafo::calculaDijkstra(int origem) {
+    HeapRadix heap;
+    long long *d = new long long[qnt_nos];
+    const GrafoCSR &g = *grafo;
+    dijkstraCSR(g, [&g](int, int e) { return g.peso(e); }, origem, d,
+                predecessores, heap);
+    // dist é int e MAX_DIST indica vértice não alcançado, distâncias
+    // maiores são limitadas em vez de estourar
+    bool limitada = false;
+    for (int i = 0; i < qnt_nos; i++) {
+        if (d[i] == INF_DIJKSTRA) {
+            dist[i] = MAX_DIST;
+        } else if (d[i] >= MAX_DIST) {
+            dist[i] = MAX_DIST - 1;
+            limitada = true;
+        } else {
+            dist[i] = d[i];
+        }
+    }
+    if (limitada) {
+        std::cout << "Distâncias maiores que " << MAX_DIST - 1 << " foram limitadas a esse valor\n";
+    }
+    delete[] d;
+}
+
+/**
+ * @brief Posição da busca em profundidade do Goldberg-Radzik
+ */
+struct QuadroGR {
+    int vertice;
+    int aresta;  /// próxima aresta a ser explorada
+    int negativas;  /// arestas de custo reduzido negativo no caminho da pilha
+};
+
+/**
+ * @brief Calcula dist e predecessores com o algoritmo de
+ * Goldberg-Radzik, para grafos com pesos negativos
+ *
+ * A cada passada, a partir dos vértices alterados na passada anterior
+ * que têm alguma aresta de custo reduzido (dist[u] + peso - dist[v])
+ * negativo, uma busca em profundidade no grafo das arestas de custo
+ * reduzido <= 0 gera uma ordem topológica, e os vértices são
+ * escaneados nessa ordem. Um ciclo nesse grafo com alguma aresta de
+ * custo reduzido negativo é um ciclo negativo, detectado na hora
+ * @param origem vértice de origem
+ * @return true Caso não exista ciclo negativo alcançável da origem
+ * @return false Caso exista ciclo negativo alcançável da origem
+ * @pre dist e predecessores alocados
+ * @post dist e predecessores preenchidos
+ */
+bool Grafo::calculaGoldbergRadzik(int origem) {
+    // cor de cada vértice na busca: BRANCO fora, CINZA na pilha, PRETO pronto
+    cor *marca = new cor[qnt_nos];
+    int *negativas = new int[qnt_nos];  // valor de QuadroGR::negativas
+    bool *em_b = new bool[qnt_nos];
+    std::vector<int> b, proximo_b, ordem_pos;
+    std::vector<QuadroGR> pilha;
+    bool ret = true;
+    int passadas = 0;
+
+    inicializaOrigem(origem);
+    for (int i = 0; i < qnt_nos; i++) {
+        marca[i] = BRANCO;
+        em_b[i] = false;
+    }
+    b.push_back(origem);
+    em_b[origem] = true;
+
+    // custo reduzido da entrada e, que sai de u
+    auto reduzido = [&](int u, int e) {
+        return (long long)dist[u] + grafo->peso(e) - dist[grafo->destino(e)];
+    };
+
+    while (!b.empty() && ret) {
+        if (++passadas > qnt_nos) {
+            ret = false;
+            break;
+        }
+        ordem_pos.clear();
+        for (int s : b) {
+            em_b[s] = false;
+            if (marca[s] != BRANCO) {
+                continue;
+            }
+            bool tem_negativa = false;
+            for (int e = grafo->inicio(s); e < grafo->fim(s) && !tem_negativa; e++) {
+                tem_negativa = reduzido(s, e) < 0;
+            }
+            if (!tem_negativa) {
+                continue;
+            }
+
+            // busca em profundidade iterativa pelas arestas de custo <= 0
+            marca[s] = CINZA;
+            negativas[s] = 0;
+            pilha.push_back({s, grafo->inicio(s), 0});
+            while (!pilha.empty() && ret) {
+                QuadroGR &q = pilha.back();
+                int u = q.vertice;
+                if (q.aresta == grafo->fim(u) || dist[u] == MAX_DIST) {
+                    marca[u] = PRETO;
+                    ordem_pos.push_back(u);
+                    pilha.pop_back();
+                    continue;
+                }
+                int e = q.aresta++;
+                long long r = reduzido(u, e);
+                if (r > 0) {
+                    continue;
+                }
+                int v = grafo->destino(e);
+                int neg = q.negativas + (r < 0);
+                if (marca[v] == BRANCO) {
+                    marca[v] = CINZA;
+                    negativas[v] = neg;
+                    pilha.push_back({v, grafo->inicio(v), neg});
+                } else if (marca[v] == CINZA && neg > negativas[v]) {
+                    // ciclo v -> ... -> u -> v com alguma aresta negativa
+                    ret = false;
+                }
+            }
+        }
+        b.clear();
+        pilha.clear();
+
+        // escaneia na ordem topológica (inverso da pós-ordem)
+        for (auto it = ordem_pos.rbegin(); it != ordem_pos.rend() && ret; ++it) {
+            int u = *it;
+            marca[u] = BRANCO;
+            conta(ARESTAS_VISITADAS, grafo->grau(u));
+            for (int e = grafo->inicio(u); e < grafo->fim(u); e++) {
+                int v = grafo->destino(e);
+                if (relax(u, v, grafo->peso(e)) && !em_b[v]) {
+                    em_b[v] = true;
+                    b.push_back(v);
+                }
+            }
+        }
+    }
+
+    delete[] marca;
+    delete[] negativas;
+    delete[] em_b;
+    return ret;
+}
+
+/**
+ * @brief Calcula dist e predecessores com o delta-stepping em paralelo
+ *
+ * Os vértices ficam em baldes de largura delta, cada thread com o seu
+ * vetor circular de baldes. O menor balde não vazio é processado em
+ * rodadas: os vértices são divididos entre as threads, que relaxam
+ * as arestas leves (peso <= delta), até o balde não receber mais
+ * vértices. Depois as arestas pesadas dos vértices que saíram do
+ * balde são relaxadas uma única vez. As distâncias são idênticas às
+ * do calculaDijkstra, em caso de empate o predecessor pode ser outro
+ * @param origem vértice de origem
+ * @pre dist e predecessores alocados, nenhum peso negativo
+ * @post dist e predecessores preenchidos
+ */
+void Grafo::calculaDeltaStepping(int origem) {
+    int t = qntThreads();
+    long long entradas = grafo->qntEntradas();
+
+    std::vector<int> maiores(t, 0);
+    paraleloPara(entradas, [&](int id, long long ini, long long fim) {
+        for (long long e = ini; e < fim; e++) {
+            maiores[id] = std::max(maiores[id], grafo->peso(e));
+        }
+    });
+    long long maior = *std::max_element(maiores.begin(), maiores.end());
+    long long largura = delta;
+    if (largura <= 0) {
+        largura = entradas ? maior * qnt_nos / entradas : 1;
+    }
+    // as distâncias pendentes estão no máximo maior / largura + 1
+    // baldes à frente do atual, assim um vetor circular basta
+    largura = std::max(largura, maior / (MAX_BALDES_DELTA - 2) + 1);
+    long long qnt_baldes = maior / largura + 2;
+
+    std::vector<std::vector<int>> baldes(t * qnt_baldes);
+    std::vector<std::vector<int>> expandidos(t);
+    std::vector<int> fronteira;
+    std::atomic<uint64_t> *estado = new std::atomic<uint64_t>[qnt_nos];
+    // última rodada em que o vértice teve as arestas relaxadas
+    std::atomic<int> *rodada = new std::atomic<int>[qnt_nos];
+    int r = 0;
+
+    for (int i = 0; i < qnt_nos; i++) {
+        estado[i].store(empacota(MAX_DIST, NIL), std::memory_order_relaxed);
+        rodada[i].store(0, std::memory_order_relaxed);
+    }
+    estado[origem].store(empacota(0, NIL));
+    baldes[0].push_back(origem);
+
+    // relaxa as arestas leves ou as pesadas do vértice u
+    auto relaxaArestas = [&](int id, int u, bool leves) {
+        int du = distEmpacotada(estado[u].load(std::memory_order_relaxed));
+        conta(ARESTAS_VISITADAS, grafo->grau(u));
+        for (int e = grafo->inicio(u); e < grafo->fim(u); e++) {
+            int w = grafo->peso(e);
+            if ((w <= largura) != leves) {
+                continue;
+            }
+            int nova = du + w;
+            if (diminuiAtomico(estado[grafo->destino(e)], nova, u)) {
+                conta(RELAXACOES, 1);
+                baldes[id * qnt_baldes + (nova / largura) % qnt_baldes]
+                    .push_back(grafo->destino(e));
+            }
+        }
+    };
+    // junta o balde b de todas as threads na fronteira
+    auto juntaBalde = [&](long long b) {
+        fronteira.clear();
+        for (int id = 0; id < t; id++) {
+            std::vector<int> &balde = baldes[id * qnt_baldes + b % qnt_baldes];
+            fronteira.insert(fronteira.end(), balde.begin(), balde.end());
+            balde.clear();
+        }
+    };
+
+    long long atual = 0;
+    while (true) {
+        bool achou = false;
+        for (long long b = atual; b < atual + qnt_baldes && !achou; b++) {
+            for (int id = 0; id < t && !achou; id++) {
+                if (!baldes[id * qnt_baldes + b % qnt_baldes].empty()) {
+                    achou = true;
+                    atual = b;
+                }
+            }
+        }
+        if (!achou) {
+            break;
+        }
+
+        // arestas leves, até o balde atual não receber mais vértices
+        for (juntaBalde(atual); !fronteira.empty(); juntaBalde(atual)) {
+            r++;
+            paraleloPara(fronteira.size(), [&](int id, long long ini, long long fim) {
+                for (long long k = ini; k < fim; k++) {
+                    int u = fronteira[k];
+                    int du = distEmpacotada(estado[u].load(std::memory_order_relaxed));
+                    // entrada antiga, o vértice já foi para outro balde
+                    // ou já está sendo relaxado nessa rodada
+                    if (du / largura != atual ||
+                        rodada[u].exchange(r, std::memory_order_relaxed) == r) {
+                        continue;
+                    }
+                    expandidos[id].push_back(u);
+                    relaxaArestas(id, u, true);
+                }
+            });
+        }
+
+        // arestas pesadas, as distâncias do balde atual já são as finais
+        fronteira.clear();
+        for (auto &exp : expandidos) {
+            fronteira.insert(fronteira.end(), exp.begin(), exp.end());
+            exp.clear();
+        }
+        r++;
+        paraleloPara(fronteira.size(), [&](int id, long long ini, long long fim) {
+            for (long long k = ini; k < fim; k++) {
+                int u = fronteira[k];
+                if (rodada[u].exchange(r, std::memory_order_relaxed) != r) {
+                    relaxaArestas(id, u, false);
+                }
+            }
+        });
+        atual++;
+    }
+
+    for (int i = 0; i < qnt_nos; i++) {
+        uint64_t x = estado[i].load(std::memory_order_relaxed);
+        dist[i] = distEmpacotada(x);
+        predecessores[i] = predEmpacotado(x);
+    }
+    delete[] estado;
+    delete[] rodada;
+}
+
+/**
+ * @brief Divide os vértices em blocos com a mesma quantidade de arestas
+ *
+ * @param qnt quantidade de blocos
+ * @return std::vector<int> qnt + 1 limites, o bloco b são os vértices
+ * [limites[b], limites[b + 1])
+ * @pre Grafo carregado
+ * @post Nenhuma
+ */
+std::vector<int> Grafo::divideVertices(int qnt) {
+    std::vector<int> limites(qnt + 1);
+    long long entradas = grafo->qntEntradas();
+    limites[0] = 0;
+    limites[qnt] = qnt_nos;
+    for (int b = 1; b < qnt; b++) {
+        // primeiro vértice cujas arestas começam depois da fração b / qnt
+        int alvo = entradas * b / qnt;
+        limites[b] = std::lower_bound(grafo->offsets, grafo->offsets + qnt_nos,
+                                      alvo) - grafo->offsets;
+        limites[b] = std::max(limites[b], limites[b - 1]);
+    }
+    return limites;
+}
+
+/**
+ * @brief Calcula dist e predecessores com o Bellman-Ford em paralelo
+ *
+ * A cada passada os vértices alterados na passada anterior são
+ * divididos entre as threads, em blocos com a mesma quantidade de
+ * arestas. Distância e predecessor de cada vértice ficam juntos em um
+ * inteiro atômico, assim são sempre atualizados juntos. As distâncias
+ * são idênticas às do calculaBellmanFord, em caso de empate o
+ * predecessor pode ser outro, mas sempre forma uma árvore de
+ * caminhos mínimos
+ * @param origem vértice de origem
+ * @return true Caso não exista ciclo negativo alcançável da origem
+ * @return false Caso exista ciclo negativo alcançável da origem
+ * @pre dist e predecessores alocados
+ * @post dist e predecessores preenchidos
+ */
+bool Grafo::calculaBellmanFordParalelo(int origem) {
+    int i, qnt;
+    int t = qntThreads();
+    std::vector<int> limites = divideVertices(t);
+    std::atomic<uint64_t> *estado = new std::atomic<uint64_t>[qnt_nos];
+    // vértices alterados na passada anterior e na atual
+    std::atomic<char> *alterado = new std::atomic<char>[qnt_nos];
+    std::atomic<char> *proximo = new std::atomic<char>[qnt_nos];
+    bool ret = true;
+
+    for (i = 0; i < qnt_nos; i++) {
+        estado[i].store(empacota(MAX_DIST, NIL), std::memory_order_relaxed);
+        alterado[i].store(0, std::memory_order_relaxed);
+        proximo[i].store(0, std::memory_order_relaxed);
+    }
+    estado[origem].store(empacota(0, NIL));
+    alterado[origem].store(1);
+
+    for (qnt = 0; qnt < (qnt_nos - 1); qnt++) {
+        std::atomic<bool> mudou(false);
+        conta(PASSADAS_BELLMAN_FORD, 1);
+        paraleloPara(t, [&](int, long long ini, long long fim) {
+            bool local = false;
+            for (int u = limites[ini]; u < limites[fim]; u++) {
+                if (!alterado[u].load(std::memory_order_relaxed)) {
+                    continue;
+                }
+                alterado[u].store(0, std::memory_order_relaxed);
+                int du = distEmpacotada(estado[u].load(std::memory_order_relaxed));
+                conta(ARESTAS_VISITADAS, grafo->grau(u));
+                for (int e = grafo->inicio(u); e < grafo->fim(u); e++) {
+                    int v = grafo->destino(e);
+                    if (diminuiAtomico(estado[v], du + grafo->peso(e), u)) {
+                        conta(RELAXACOES, 1);
+                        proximo[v].store(1, std::memory_order_relaxed);
+                        local = true;
+                    }
+                }
+            }
+            if (local) {
+                mudou.store(true, std::memory_order_relaxed);
+            }
+        });
+        // se não teve nenhum relax nessa passada pare de executar o algoritmo
+        if (!mudou.load()) {
+            break;
+        }
+        std::swap(alterado, proximo);
+    }
+
+    for (i = 0; i < qnt_nos; i++) {
+        uint64_t x = estado[i].load(std::memory_order_relaxed);
+        dist[i] = distEmpacotada(x);
+        predecessores[i] = predEmpacotado(x);
+    }
+
+    // percorre cada uma das arestas, buscando ciclo negativo
+    if (qnt == qnt_nos - 1) {
+        std::atomic<bool> ciclo(false);
+        paraleloPara(t, [&](int, long long ini, long long fim) {
+            for (int u = limites[ini]; u < limites[fim]; u++) {
+                if (dist[u] == MAX_DIST) {
+                    continue;
+                }
+                for (int e = grafo->inicio(u); e < grafo->fim(u); e++) {
+                    if (dist[grafo->destino(e)] > dist[u] + grafo->peso(e)) {
+                        ciclo.store(true, std::memory_order_relaxed);
+                        return;
+                    }
+                }
+            }
+        });
+        ret = !ciclo.load();
+    }
+
+    delete[] estado;
+    delete[] alterado;
+    delete[] proximo;
+    return ret;
+}
+
+/**
+ * @brief Imprime a distância e o caminho de todos os vértices
+ *
+ * @param origem vértice de origem dos caminhos
+ * @param sem_ciclo resultado do algoritmo, se falso somente
+ * informa o ciclo negativo
+ * @pre dist e predecessores preenchidos
+ * @post caminhos impressos na saída padrão
+ */
+void Grafo::printCaminhosMinimos(int origem, bool sem_ciclo) {
+    cronometra("impressao");
+    if (!sem_ciclo) {
+        std::cout << "O Grafo Possui ciclo negativo" << std::endl;
+        return;
+    }
+    for(int i = 0; i < qnt_nos; i++) {
+        std::cout   << "destino: "  << i        << ' '
+                    << "dist: "     << dist[i]  << ' '
+                    << "caminho: ";
+
+        printCaminho(i, origem);
+        std::cout << std::endl;
+    }
+}
+
+/**
+ * @brief Executa o algorítimo de BellMan-Ford
+ *
+ * Algorítimo que encontra o menor caminho de todos os vértices em
+ * relação ao vertice passado como argumento
+ * @param vertice_inicio o vértice para qual todos os outros devem
+ * encontrar o menor caminho
+ * @return true Caso o Grafo não possua um cíclo negativo
+ * @return false Caso o Grafo possua um cíclo negativo
+ * @pre vértice de início está contido no Grafo,
+ *      Grafo deve ser orientado,
+ * @post Nenhuma
+ */
+bool Grafo::bellmanFord(int vertice_inicio) {
+    return caminhoMinimo(vertice_inicio, BELLMAN_FORD);
+}
+
+/**
+ * @brief Encontra o menor caminho de todos os vértices em relação
+ * ao vértice passado como argumento, com o algoritmo escolhido
+ *
+ * Imprime o resultado no mesmo formato do bellmanFord
+ * @param vertice_inicio vértice de origem
+ * @param motor algoritmo a ser utilizado
+ * @return true Caso o Grafo não possua um ciclo negativo
+ * @return false Caso o Grafo possua um ciclo negativo
+ * @pre vértice de início está contido no Grafo,
+ *      Grafo carregado
+ * @post Nenhuma
+ */
+bool Grafo::caminhoMinimo(int vertice_inicio, motorCaminho motor) {
+    cronometra("calculo.caminho");
+    bool ret = true;
+    if (motor == CAMINHO_AUTOMATICO) {
+        motor = escolheMotorCaminho();
+    }
+    if ((motor == DIJKSTRA || motor == DELTA_STEPPING) &&
+        grafo->temPesoNegativo()) {
+        std::cout << "Grafo com pesos negativos, algoritmo não atende ao requisito\n";
+        return false;
+    }
+    predecessores = new int[qnt_nos];
+    dist		  = new int[qnt_nos];
+
+    switch (motor) {
+        case BELLMAN_FORD:
+            ret = calculaBellmanFord(vertice_inicio);
+            break;
+        case BELLMAN_FORD_FILA:
+            ret = calculaBellmanFordFila(vertice_inicio);
+            break;
+        case BELLMAN_FORD_PARALELO:
+            ret = calculaBellmanFordParalelo(vertice_inicio);
+            break;
+        case DIJKSTRA:
+            calculaDijkstra(vertice_inicio);
+            break;
+        case GOLDBERG_RADZIK:
+            ret = calculaGoldbergRadzik(vertice_inicio);
+            break;
+        case DELTA_STEPPING:
+            calculaDeltaStepping(vertice_inicio);
+            break;
+        case CAMINHO_AUTOMATICO:
+            break;
+    }
+    printCaminhosMinimos(vertice_inicio, ret);
+
+    delete[] dist;
+    delete[] predecessores;
+    return ret;
+}
+
+/**
+ * @brief Calcula a distância entre todos os pares de vértices com o
+ * algoritmo de Johnson e grava a matriz em um arquivo binário
+ *
+ * Um Bellman-Ford a partir de uma origem virtual ligada a todos os
+ * vértices calcula os potenciais h, que tornam os pesos
+ * peso + h[inicio] - h[fim] não negativos. Depois um Dijkstra é
+ * executado a partir de cada origem, em paralelo com roubo de
+ * trabalho, e as linhas são gravadas em blocos (ver CabecalhoMatriz)
+ * @param filename o nome do arquivo a ser escrito
+ * @param origens vértices de origem das linhas, vazio para todos
+ * @return true se a matriz foi gravada
+ * @return false caso o grafo possua ciclo negativo ou ocorra um erro
+ * de escrita
+ * @pre Grafo carregado, origens contidas no Grafo
+ * @post Nenhuma
+ */
+bool Grafo::todosOsPares(const std::string &filename, std::vector<int> origens) {
+    cronometra("calculo.todos_pares");
+    if (origens.empty()) {
+        origens.resize(qnt_nos);
+        for (int i = 0; i < qnt_nos; i++) {
+            origens[i] = i;
+        }
+    }
+
+    // potenciais: a origem virtual tem aresta de peso 0 para todos
+    int *h = new int[qnt_nos];
+    bool sem_ciclo = true;
+    if (grafo->temPesoNegativo()) {
+        predecessores = new int[qnt_nos];
+        dist = new int[qnt_nos];
+        for (int i = 0; i < qnt_nos; i++) {
+            dist[i] = 0;
+            predecessores[i] = NIL;
+        }
+        sem_ciclo = passadasBellmanFord();
+        std::copy(dist, dist + qnt_nos, h);
+        delete[] predecessores;
+        delete[] dist;
+    } else {
+        std::fill(h, h + qnt_nos, 0);
+    }
+    if (!sem_ciclo) {
+        std::cout << "O Grafo Possui ciclo negativo" << std::endl;
+        delete[] h;
+        return false;
+    }
+
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        delete[] h;
+        return false;
+    }
+    CabecalhoMatriz cab;
+    memcpy(cab.magica, "PAAM", 4);
+    cab.versao = VERSAO_MATRIZ;
+    cab.qnt_nos = qnt_nos;
+    cab.qnt_linhas = origens.size();
+    file.write((const char*)&cab, sizeof(cab));
+    file.write((const char*)origens.data(), sizeof(int) * origens.size());
+
+    // cada thread tem os seus vetores e o seu heap
+    int t = qntThreads();
+    long long *d = new long long[(long long)t * qnt_nos];
+    int *pred = new int[(long long)t * qnt_nos];
+    std::vector<HeapRadix> heaps(t);
+    int por_bloco = std::max(1, MAX_BLOCO_MATRIZ / std::max(qnt_nos, 1));
+    int *bloco = new int[(long long)std::min<int>(por_bloco, origens.size()) * qnt_nos];
+
+    for (size_t ini = 0; ini < origens.size() && file.good(); ini += por_bloco) {
+        int qnt = std::min<size_t>(por_bloco, origens.size() - ini);
+        paraleloRoubo(qnt, [&](int id, int l) {
+            int s = origens[ini + l];
+            long long *ds = d + (long long)id * qnt_nos;
+            int *linha = bloco + (long long)l * qnt_nos;
+            dijkstraCSR(*grafo, [&](int u, int e) {
+                return (long long)grafo->peso(e) + h[u] - h[grafo->destino(e)];
+            }, s, ds, pred + (long long)id * qnt_nos, heaps[id]);
+            for (int v = 0; v < qnt_nos; v++) {
+                linha[v] = (ds[v] == INF_DIJKSTRA) ? INT_MAX :
+                    (int)(ds[v] - h[s] + h[v]);
+            }
+        });
+        file.write((const char*)bloco, sizeof(int) * (long long)qnt * qnt_nos);
+    }
+
+    delete[] h;
+    delete[] d;
+    delete[] pred;
+    delete[] bloco;
+    return file.good();
+}
+
+/**
+ * @brief Escolhe o algoritmo de menor caminho mais rápido para o grafo
+ *
+ * Sem pesos negativos o Dijkstra, ou o delta-stepping quando o grafo
+ * é grande e tem mais de uma thread, caso contrário o Goldberg-Radzik
+ * @return motorCaminho DIJKSTRA, DELTA_STEPPING ou GOLDBERG_RADZIK
+ * @pre Grafo carregado
+ * @post Nenhuma
+ */
+motorCaminho Grafo::escolheMotorCaminho() {
+    if (!grafo->temPesoNegativo()) {
+        if (qntThreads() > 1 && grafo->qntEntradas() >= MIN_DELTA_STEPPING) {
+            return DELTA_STEPPING;
+        }
+        return DIJKSTRA;
+    }
+    return GOLDBERG_RADZIK;
+}
@@ -0,0 +1,68 @@
+/**
+ * @file conjunto_disjunto.cpp
+ * @author Victor Emanuel Almeida e Milena Lucas dos Santos
+ * @brief Implementa todas as funcionalidade da classe ConjuntoDisjunto
+ * @version 0.1
+ * @date 17/10/2026
+ */
+
+#include <iostream>
+#include <utility>
+
+#include "conjunto_disjunto.hpp"
+
+/**
+ * @brief Construtor da classe ConjuntoDisjunto
+ *
+ * @param qnt quantidade de elementos, numerados de 0 a qnt - 1
+ * @pre Nenhuma
+ * @post cada elemento está em um conjunto só dele
+ */
+ConjuntoDisjunto::ConjuntoDisjunto(int qnt) {
+    debug("Construindo um ConjuntoDisjunto\n");
+    this->qnt = qnt;
+    pai = new int[qnt];
+    tamanho = new int[qnt];
+    for (int i = 0; i < qnt; i++) {
+        pai[i] = i;
+        tamanho[i] = 1;
+    }
+}
+
+/**
+ * @brief Une os conjuntos de a e b
+ *
+ * A raiz do conjunto menor passa a apontar para a do maior
+ * @param a elemento
+ * @param b elemento
+ * @return true se estavam em conjuntos diferentes
+ * @return false se já estavam no mesmo conjunto
+ * @pre a e b em [0, qnt)
+ * @post a e b no mesmo conjunto
+ */
+bool ConjuntoDisjunto::une(int a, int b) {
+    conta(OPERACOES_UNIAO_BUSCA, 1);
+    a = acha(a);
+    b = acha(b);
+    if (a == b) {
+        return false;
+    }
+    if (tamanho[a] < tamanho[b]) {
+        std::swap(a, b);
+    }
+    pai[b] = a;
+    tamanho[a] += tamanho[b];
+    return true;
+}
+
+/**
+ * @brief Destrutor da classe ConjuntoDisjunto
+ *
+ * @pre Nenhuma
+ * @post Nenhuma
+ */
+ConjuntoDisjunto::~ConjuntoDisjunto() {
+    delete[] pai;
+    delete[] tamanho;
+    debug("Destruindo um ConjuntoDisjunto\n");
+}
@@ -0,0 +1,83 @@
+/**
+ * @file conjunto_disjunto.hpp
+ * @author Victor Emanuel Almeida e Milena Lucas dos Santos
+ * @brief Define a classe ConjuntoDisjunto (union-find)
+ *
+ * @version 0.1
+ * @date 17/10/2026
+ */
+
+#ifndef CONJUNTO_DISJUNTO
+#define CONJUNTO_DISJUNTO
+
+#include "../utils/debug.hpp"
+#include "../utils/instrumentacao.hpp"
+
+/**
+ * @brief Floresta de conjuntos disjuntos, com compressão de caminho
+ * e união pelo tamanho
+ *
+ * Utilizado no algoritmo de Kruskal, cada conjunto é identificado
+ * pelo seu representante (a raiz da árvore)
+ */
+class ConjuntoDisjunto {
+    private:
+    int qnt;  /// quantidade de elementos
+    int *pai;  /// pai de cada elemento, a raiz é pai de si mesma
+    int *tamanho;  /// tamanho do conjunto, válido somente nas raízes
+
+    public:
+    /**
+     * @brief Construtor da classe ConjuntoDisjunto
+     *
+     * @param qnt quantidade de elementos, numerados de 0 a qnt - 1
+     * @pre Nenhuma
+     * @post cada elemento está em um conjunto só dele
+     */
+    ConjuntoDisjunto(int qnt);
+
+    ConjuntoDisjunto(const ConjuntoDisjunto &) = delete;
+    ConjuntoDisjunto& operator = (const ConjuntoDisjunto &) = delete;
+
+    /**
+     * @brief Encontra o representante do conjunto de x
+     *
+     * Cada elemento visitado passa a apontar para o avô,
+     * encurtando o caminho até a raiz
+     * @param x elemento
+     * @return int representante do conjunto que contém x
+     * @pre x em [0, qnt)
+     * @post Nenhuma
+     */
+    int acha(int x) {
+        conta(OPERACOES_UNIAO_BUSCA, 1);
+        while (pai[x] != x) {
+            pai[x] = pai[pai[x]];
+            x = pai[x];
+        }
+        return x;
+    }
+
+    /**
+     * @brief Une os conjuntos de a e b
+     *
+     * A raiz do conjunto menor passa a apontar para a do maior
+     * @param a elemento
+     * @param b elemento
+     * @return true se estavam em conjuntos diferentes
+     * @return false se já estavam no mesmo conjunto
+     * @pre a e b em [0, qnt)
+     * @post a e b no mesmo conjunto
+     */
+    bool une(int a, int b);
+
+    /**
+     * @brief Destrutor da classe ConjuntoDisjunto
+     *
+     * @pre Nenhuma
+     * @post Nenhuma
+     */
+    ~ConjuntoDisjunto();
+};
+
+#endif // CONJUNTO_DISJUNTO
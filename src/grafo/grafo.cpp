@@ -8,23 +8,13 @@
 
 #include "grafo.hpp"
 #include "no_grafo.hpp"
+#include "leitor_arestas.hpp"
+#include "../utils/arquivo_mapeado.hpp"
 #include <algorithm>
+#include <climits>
 #include <iostream>
 #include <iterator>
 
-template<class T> static void selectionSort(T *v, int tam) {
-    int i, j, menor;
-    for(i = 0; i < tam; i++) {
-        menor = i;
-        for(j = i + 1; j < tam; j++) {
-            if (v[j] < v[menor]) {
-                menor = j;
-            }
-        }
-        std::swap(v[i], v[menor]);
-    }
-}
-
 /**
  * @brief Construtor da classe Grafo
  *
@@ -37,6 +27,41 @@ Grafo::Grafo() {
     cores = nullptr;
     predecessores = nullptr;
     dist = nullptr;
+    descoberta = nullptr;
+    finalizacao = nullptr;
+    tempo = 0;
+    ordem = nullptr;
+    qnt_ordem = 0;
+    transposto = nullptr;
+    arvore_busca = nullptr;
+    remove_paralelas = false;
+    delta = 0;
+}
+
+/**
+ * @brief Define se as arestas paralelas devem ser removidas
+ * ao carregar o grafo
+ *
+ * Das arestas com mesmo início e fim é mantida a de menor peso
+ * @param remover verdadeiro para remover as arestas paralelas
+ * @pre Nenhuma
+ * @post Vale para as próximas chamadas de ler
+ */
+void Grafo::removerArestasParalelas(bool remover) {
+    remove_paralelas = remover;
+}
+
+/**
+ * @brief Define a largura dos baldes do delta-stepping
+ *
+ * Sem ser definida, ou com 0, é utilizado o maior peso dividido
+ * pelo grau médio
+ * @param delta largura dos baldes, 0 para automático
+ * @pre delta >= 0
+ * @post Vale para as próximas execuções do delta-stepping
+ */
+void Grafo::defineDelta(int delta) {
+    this->delta = delta;
 }
 
 /**
@@ -54,42 +79,110 @@ void Grafo::constroi(std::istream& file) {
     getline(file, line);
     qnt_nos = atoi((line.substr(line.find_first_of('=') + 1)).c_str());
 
-    this->grafo = new Lista<NoGrafo>[qnt_nos];
-
-    NoGrafo temp;
-    int index;
+    // guarda todas as arestas e ordena somente uma vez no final
+    std::vector<Aresta> arestas;
+    Aresta temp;
     while (getline(file, line)) {
-        temp.id = atoi(&line[line.find_first_of(',') + 1]);
-        temp.peso = atoi(&line[line.find_first_of(':') + 1]);
-        index = atoi(&line[1]);
-        grafo[index].insereOrdenado(temp);
-        if (!isOrientado) {
-            std::swap(index, temp.id);
-            grafo[index].insereOrdenado(temp);
+        if (line.empty()) {
+            continue;
         }
+        temp.inicio = atoi(&line[1]);
+        temp.fim = atoi(&line[line.find_first_of(',') + 1]);
+        temp.peso = atoi(&line[line.find_first_of(':') + 1]);
+        arestas.push_back(temp);
     }
+
+    criaCSR(arestas);
+}
+
+/**
+ * @brief Constrói um grafo a partir do texto de um arquivo
+ * já carregado na memória
+ *
+ * Mesmo formato de constroi(std::istream&), mas as arestas
+ * são lidas em paralelo
+ * @param inicio primeiro caractere do texto
+ * @param fim posição seguinte ao último caractere do texto
+ * @pre texto no formato de entrada
+ * @post Grafo alocado e contendo os dados do texto
+ */
+void Grafo::constroi(const char *inicio, const char *fim) {
+    std::string valor;
+    leCabecalho(inicio, fim, valor);
+    isOrientado = (valor == "sim");
+
+    leCabecalho(inicio, fim, valor);
+    qnt_nos = atoi(valor.c_str());
+
+    std::vector<Aresta> arestas;
+    leArestas(inicio, fim, arestas);
+
+    criaCSR(arestas);
+}
+
+/**
+ * @brief Cria o GrafoCSR com as arestas lidas
+ *
+ * As posições do GrafoCSR são int, então grafos com mais entradas
+ * nas listas de adjacência são recusados
+ * @param arestas arestas lidas, o vetor é reaproveitado
+ * @pre qnt_nos e isOrientado definidos
+ * @post grafo alocado, ou nullptr caso seja grande demais
+ */
+void Grafo::criaCSR(std::vector<Aresta> &arestas) {
+    long long entradas = isOrientado ? arestas.size() : 2 * arestas.size();
+    if (entradas > INT_MAX) {
+        std::cout << "grafo com " << entradas << " entradas, o máximo é " << INT_MAX << '\n';
+        this->grafo = nullptr;
+        qnt_nos = 0;
+        return;
+    }
+    this->grafo = new GrafoCSR(arestas, qnt_nos, isOrientado,
+                               remove_paralelas);
 }
 
 /**
  * @brief Cria o grafo com as informações contidas no arquivo
  *
- * ver a função constroi
+ * ver a função constroi, o arquivo é mapeado na memória
+ * e lido diretamente de lá. Caso seja um arquivo binário
+ * (ver salvar) os vetores do grafo são o próprio arquivo
  * @param filename o nome do arquivo a ser lido
  * @pre filename contem um nome de arquivo valido e grafo desalocado
  * @post Grafo inicializado com os dados
  */
 void Grafo::ler(std::string filename) {
-    std::ifstream file;
-    file.open(filename);
+    cronometra("leitura");
+    ArquivoMapeado *file = new ArquivoMapeado();
 
-    if(file.is_open()){
-        constroi(file);
-    }else{
+    if(!file->abre(filename)){
         std::cout << "arquivo " << filename << " invalido\n";
+        delete file;
+    }else if (GrafoCSR::isBinario(*file)) {
+        this->grafo = GrafoCSR::carregar(file, isOrientado);
+        qnt_nos = grafo ? grafo->qntNos() : 0;
+    }else{
+        constroi(file->inicio(), file->fim());
+        delete file;
     }
-    
+}
 
-    file.close();
+/**
+ * @brief Salva o grafo no formato binário, que pode ser lido
+ * novamente com ler sem nenhum processamento
+ *
+ * @param filename o nome do arquivo a ser escrito
+ * @return true se o arquivo foi escrito
+ * @return false caso o grafo não esteja carregado ou ocorra um erro
+ * de escrita
+ * @pre Nenhuma
+ * @post Nenhuma
+ */
+bool Grafo::salvar(std::string filename) {
+    if (grafo == nullptr) {
+        return false;
+    }
+    return grafo->salvar(filename, isOrientado);
 }
 
 /**
@@ -120,7 +213,12 @@ void Grafo::inicializaOrigem(int origem) {
  * @post menor peso entre início e fim
  */
 bool Grafo::relax(const int inicio, const int fim, const int peso) {
+    // um vértice ainda não alcançado não encurta nenhum caminho
+    if (dist[inicio] == MAX_DIST) {
+        return false;
+    }
     if (dist[fim] > (dist[inicio] + peso)) {
+        conta(RELAXACOES, 1);
         dist[fim] = dist[inicio] + peso;
         predecessores[fim] = inicio;
         return true;
@@ -135,6 +233,7 @@ bool Grafo::relax(const int inicio, const int fim, const int peso) {
  * @post Nenhuma
  */
 void Grafo::ler() {
+    cronometra("leitura");
     debug("Informe os dados na mesma sintaxe do arquivo\n");
     constroi(std::cin);
 }
@@ -148,7 +247,14 @@ void Grafo::ler() {
 void Grafo::mostrar() {
     for (int i = 0; i < this->qnt_nos; i++) {
         std::cout << "Vértices adjacentes a " << i << ": ";
-        grafo[i].mostrar(" ");
+        if (grafo->grau(i) == 0) {
+            std::cout << "Lista Vazia\n";
+            continue;
+        }
+        for (int e = grafo->inicio(i); e < grafo->fim(i); e++) {
+            std::cout << '[' << grafo->destino(e) << ']'
+                      << (e + 1 < grafo->fim(i) ? ' ' : '\n');
+        }
     }
 }
 
@@ -159,10 +265,7 @@ void Grafo::mostrar() {
  * @post Nenhuma
  */
 int Grafo::qntArestas() {
-    int qnt = 0;
-    for (int i = 0; i < qnt_nos; i++) {
-        qnt += grafo[i].tam();
-    }
+    int qnt = grafo->qntEntradas();
     if (!this->isOrientado) {
         qnt /= 2;
     }
@@ -170,13 +273,36 @@ int Grafo::qntArestas() {
 }
 
 /**
- * @brief Imprime a lista que contém a ordem de acesso dos vertices
+ * @brief Desaloca o grafo e tudo que foi calculado a partir dele
  *
- * @pre lista ordem alocada
- * @post lista impressa na saída padrão
+ * @pre Nenhuma
+ * @post grafo, transposto e arvore_busca nulos
+ */
+void Grafo::descartaGrafo() {
+    delete grafo;
+    delete transposto;
+    delete arvore_busca;
+    grafo = nullptr;
+    transposto = nullptr;
+    arvore_busca = nullptr;
+}
+
+/**
+ * @brief Imprime o vetor que contém a ordem de acesso dos vertices
+ *
+ * @pre vetor ordem preenchido
+ * @post vetor impresso na saída padrão
  */
 void Grafo::printOrdemAcesso() {
-    ordem.mostrar(" - ");
+    cronometra("impressao");
+    if (qnt_ordem == 0) {
+        std::cout << "Lista Vazia\n";
+        return;
+    }
+    for (int i = 0; i < qnt_ordem - 1; i++) {
+        std::cout << ordem[i] << " - ";
+    }
+    std::cout << ordem[qnt_ordem - 1] << "\n";
 }
 
 /**
@@ -186,6 +312,7 @@ void Grafo::printOrdemAcesso() {
  * @post vetor de predecessores impressa na saída padrão
  */
 void Grafo::printPredecessores() {
+    cronometra("impressao");
     int i;
     std::cout << "Predecessores:   ";
     for (i = 0; i < qnt_nos - 1; i++) {
@@ -200,6 +327,7 @@ void Grafo::printPredecessores() {
 }
 
 void Grafo::printDist() {
+    cronometra("impressao");
     int i;
     std::cout << "dist.:   ";
     for (i = 0; i < qnt_nos - 1; i++) {
@@ -214,23 +342,63 @@ void Grafo::printDist() {
 }
 
 /**
- * @brief Explora um vértice de cor branca, visitando recursivamente
- * todos os vertices adjacentes
+ * @brief Imprime os tempos de descoberta e finalização
+ *
+ * @pre vetores descoberta e finalizacao preenchidos
+ * @post tempos impressos na saída padrão
+ */
+void Grafo::printTempos() {
+    cronometra("impressao");
+    int i;
+    std::cout << "Descoberta:   ";
+    for (i = 0; i < qnt_nos - 1; i++) {
+        std::cout << descoberta[i] << " - ";
+    }
+    std::cout << descoberta[i] << '\n';
+    std::cout << "Finalização:   ";
+    for (i = 0; i < qnt_nos - 1; i++) {
+        std::cout << finalizacao[i] << " - ";
+    }
+    std::cout << finalizacao[i] << '\n';
+}
+
+/**
+ * @brief Explora um vértice de cor branca, visitando todos os
+ * vértices alcançáveis a partir dele
  *
+ * Sem recursão: cada vértice cinza tem um quadro na pilha com a
+ * próxima aresta a ser explorada, assim a ordem de visita é a mesma
+ * da versão recursiva e caminhos longos não estouram a pilha
  * @param index Vértice a ser explorado, cor branca
+ * @param pilha vetor com pelo menos qnt_nos quadros
  * @pre Somente chamado pela buscaEmProfuntidade
  * @post Vértice index totalmente explorado, cor preto
  */
-void Grafo::buscaEmProfundidadeVisit(int index) {
-    ordem.insereFim(index);
+void Grafo::buscaEmProfundidadeVisit(int index, QuadroDFS *pilha) {
+    int topo = 0;
+    ordem[qnt_ordem++] = index;
     cores[index] = CINZA;
-    for(auto it = grafo[index].inicio(); it; it = it->proximo) {
-        if(cores[it->dado.id] == BRANCO) {
-            predecessores[it->dado.id] = index;
-            buscaEmProfundidadeVisit(it->dado.id);
+    descoberta[index] = ++tempo;
+    pilha[topo++] = {index, grafo->inicio(index)};
+
+    while (topo > 0) {
+        QuadroDFS &q = pilha[topo - 1];
+        if (q.aresta == grafo->fim(q.vertice)) {
+            conta(ARESTAS_VISITADAS, grafo->grau(q.vertice));
+            cores[q.vertice] = PRETO;
+            finalizacao[q.vertice] = ++tempo;
+            topo--;
+            continue;
+        }
+        int v = grafo->destino(q.aresta++);
+        if (cores[v] == BRANCO) {
+            predecessores[v] = q.vertice;
+            ordem[qnt_ordem++] = v;
+            cores[v] = CINZA;
+            descoberta[v] = ++tempo;
+            pilha[topo++] = {v, grafo->inicio(v)};
         }
     }
-    cores[index] = PRETO;
 }
 
 /**
@@ -242,10 +410,17 @@ void Grafo::buscaEmProfundidadeVisit(int index) {
  * @post ordem de visitação vértices impressa na saída padrão
  */
 void Grafo::buscaEmProfundidade(int vertice_inicio) {
+    cronometra("calculo.dfs");
     int i;
+    QuadroDFS *pilha = new QuadroDFS[qnt_nos];
 
     predecessores = new int[qnt_nos];
     cores         = new cor[qnt_nos];
+    ordem         = new int[qnt_nos];
+    descoberta    = new int[qnt_nos];
+    finalizacao   = new int[qnt_nos];
+    qnt_ordem     = 0;
+    tempo         = 0;
 
     // inicialização
     for(i = 0; i < qnt_nos; i++) {
@@ -255,61 +430,25 @@ void Grafo::buscaEmProfundidade(int vertice_inicio) {
 
     for(i = vertice_inicio; i < qnt_nos; i++) {
         if (cores[i] == BRANCO) {
-            buscaEmProfundidadeVisit(i);
+            buscaEmProfundidadeVisit(i, pilha);
         }
     }
 
     for(i = 0; i < vertice_inicio; i++) {
         if (cores[i] == BRANCO) {
-            buscaEmProfundidadeVisit(i);
+            buscaEmProfundidadeVisit(i, pilha);
         }
     }
 
     printOrdemAcesso();
+    printTempos();
 
+    delete[] pilha;
     delete[] cores;
     delete[] predecessores;
-    ordem.limpar();
-}
-
-static int getGrau(int *pred, int index) {
-    int count = 0;
-    while(pred[index] != NIL) {
-        index = pred[index];
-        count++;
-    }
-    return count;
-}
-
-// problema: se u ou v forem o vértice inicial da busca
-static int BFSPrimeiroAncestralComum(int *pred, int u, int v) {
-    // encontra se qualquer um dos 2 não está contido na árvore
-    if (pred[u] == NIL || pred[v] == NIL) {
-        std::cout << "não tem caminhos\n";
-    }
-    // encontra o nível de profundidade na árvore
-    int grau_u = getGrau(pred, u);
-    int grau_v = getGrau(pred, v);
-    // iguala a profundidade dos 2 para poder pesquisar
-    // ancestrais comuns
-    if (grau_u > grau_v) {
-        while(grau_u != grau_v) {
-            u = pred[u];
-            grau_u--;
-        }
-    }else if (grau_u < grau_v){
-        while(grau_u != grau_v) {
-            v = pred[v];
-            grau_v--;
-        }
-    }
-    // caso u seja 
-    do{
-        u = pred[u];
-        v = pred[v];
-    }while(u != v);
-
-    return u;
+    delete[] ordem;
+    delete[] descoberta;
+    delete[] finalizacao;
 }
 
 /**
@@ -321,53 +460,49 @@ static int BFSPrimeiroAncestralComum(int *pred, int u, int v) {
  * @post ordem de visitação vértices impressa na saída padrão
  */
 void Grafo::buscaEmLargura(int vertice_inicio) {
-    int i;
-    Lista<int> fila;
+    buscaEmLargura(vertice_inicio, BUSCA_FILA);
+}
+
+/**
+ * @brief Busca em largura com o algoritmo escolhido
+ *
+ * Imprime o resultado no mesmo formato da buscaEmLargura
+ * @param vertice_inicio deve estar dentro dos limites do vértice
+ * @param motor algoritmo a ser utilizado
+ * @pre Grafo inicializado com ler
+ * @post ordem de visitação vértices impressa na saída padrão
+ */
+void Grafo::buscaEmLargura(int vertice_inicio, motorBusca motor) {
+    cronometra("calculo.bfs");
+    if (motor == BUSCA_AUTOMATICA) {
+        motor = escolheMotorBusca();
+    }
     predecessores = new int[qnt_nos];
-    cores         = new cor[qnt_nos];
     dist		  = new int[qnt_nos];
+    ordem         = new int[qnt_nos];
+    qnt_ordem     = 0;
 
-    // inicialização
-    for(i = 0; i < qnt_nos; i++) {
-        cores[i] = BRANCO;
-        predecessores[i] = NIL;
-        dist[i] = MAX_DIST;
-    }
-    cores[vertice_inicio] = CINZA;
-    dist[vertice_inicio] = 0;
-    fila.insereFim(vertice_inicio);
-    ordem.insereFim(vertice_inicio);
-
-    int cabeca;
-    while(!fila.isVazia()) {
-        cabeca = fila.inicio()->dado;
-        for(auto it = grafo[cabeca].inicio(); it; it = it->proximo) {
-            if (cores[it->dado.id] == BRANCO) {
-                int salva_id = it->dado.id;
-                cores[salva_id] = CINZA;
-                dist[salva_id] = dist[cabeca] + 1;
-                predecessores[salva_id] = cabeca;
-                fila.insereFim(salva_id);
-                ordem.insereFim(salva_id);
-            }
-        }
-        fila.retiraInicio();
-        cores[cabeca] = PRETO;
+    switch (motor) {
+        case BUSCA_DIRECAO_OTIMIZADA:
+            calculaBuscaDirecaoOtimizada(vertice_inicio);
+            break;
+        case BUSCA_PARALELA:
+            calculaBuscaParalela(vertice_inicio);
+            break;
+        default:
+            calculaBuscaFila(vertice_inicio);
+            break;
     }
+    conta(VERTICES_ENFILEIRADOS, qnt_ordem);
     printOrdemAcesso();
     printPredecessores();
-    int u, v;
-    std::cout << "entre com 2 vértices: ";
-    std::cin >> u >> v;
-    std::cout << "Grau o vértice " << u <<  " = " << getGrau(this->predecessores, u) << '\n';
-    std::cout << "Grau o vértice " << v <<  " = " << getGrau(this->predecessores, v) << '\n';
 
-    std::cout << "Primeiro antecessor comum = " << BFSPrimeiroAncestralComum(this->predecessores, u, v) << '\n';
+    delete arvore_busca;
+    arvore_busca = new IndiceLCA(predecessores, qnt_nos, vertice_inicio);
 
-    delete[] cores;
     delete[] dist;
     delete[] predecessores;
-    ordem.limpar();
+    delete[] ordem;
 }
 
 /**
@@ -395,166 +530,26 @@ void Grafo::printCaminho(int inicio, int fim) {
 }
 
 /**
- * @brief Executa o algorítimo de BellMan-Ford
- *
- * Algorítimo que encontra o menor caminho de todos os vértices em
- * relação ao vertice passado como argumento
- * @param vertice_inicio o vértice para qual todos os outros devem
- * encontrar o menor caminho
- * @return true Caso o Grafo não possua um cíclo negativo
- * @return false Caso o Grafo possua um cíclo negativo
- * @pre vértice de início está contido no Grafo,
- *      Grafo deve ser orientado,
- * @post Nenhuma
- */
-bool Grafo::bellmanFord(int vertice_inicio) {
-    int i, qnt;
-    bool ret;
-    predecessores = new int[qnt_nos];
-    dist		  = new int[qnt_nos];
-
-    inicializaOrigem(vertice_inicio);
-
-    for (qnt = 0; qnt < (qnt_nos - 2); qnt++) {
-        ret = false;
-        // percorre cada uma das arestas
-        for(i = 0; i < qnt_nos; i++) {
-            for(auto it = grafo[i].inicio(); it; it = it->proximo) {
-                if (relax(i, it->dado.id, it->dado.peso)) {
-                    ret = true;
-                }
-            }
-        }
-        // se não teve nenhum relax nessa interação por todas as arestas
-        // pare de executar o algoritmo
-        if (!ret) {
-            break;
-        }
-    }
-
-    // percorre cada uma das arestas, buscando ciclo negativo
-    ret = true;
-    for(i = 0; i < qnt_nos; i++) {
-        for (auto it = grafo[i].inicio(); it; it = it->proximo) {
-            if (dist[it->dado.id] > dist[i] + it->dado.peso) {
-                ret = false;
-                break;
-            }
-        }
-    }
-
-    if (ret) {
-        for(i = 0; i < qnt_nos; i++) {
-            std::cout   << "destino: "  << i        << ' '
-                        << "dist: "     << dist[i]  << ' '
-                        << "caminho: ";
-
-            printCaminho(i, vertice_inicio);
-            std::cout << std::endl;
-        }
-    }else {
-        std::cout << "O Grafo Possui ciclo negativo" << std::endl;
-    }
-
-    delete[] dist;
-    delete[] predecessores;
-    return ret;
-}
-
-/**
- * @brief Busca no Vetor de Arestas uma Aresta simétrica
+ * @brief Copia cada aresta do grafo uma única vez para um vetor
  *
- * somente utilizado para kruskal
- * @param v Vetor de Arestas
- * @param tam Tamanho do vetor
- * @param dado Referência para Aresta a ser buscada
- * @return true Existe Uma aresta simétrica no vetor
- * @return false Não existe Uma aresta simétrica no vetor
- * @pre Vetor de arestas carregado
+ * No grafo não orientado cada aresta aparece nas listas dos 2 vértices,
+ * somente a entrada com início < fim é copiada (laços são ignorados).
+ * As arestas ficam ordenadas por (início, fim)
+ * @param v Vetor de Arestas, com pelo menos qntArestas() posições
+ * @return int quantidade de arestas copiadas
+ * @pre Grafo carregado
  * @post Nenhuma
  */
-bool Grafo::existeSimetrico(Aresta *v, int tam, Aresta &dado) {
-    for (int i = 0; i < tam; i++) {
-        if (v[i].isSimetrica(dado)) {
-            return true;
-        }
-    }
-    return false;
-}
-
-void Grafo::kruskal() {
-    Aresta *arvore;
-    Lista<int> *p;
-    Lista<Aresta> A;
-    Lista<Lista<int>*> conjuntoV;
-    Lista<int> *conj_u, *conj_v;
-    int i, c, peso;
-    int qnt_aresta = this->qntArestas();
-    arvore = new Aresta[qnt_aresta];
-
-    //conjunto (v), criando conjunto
-    for(i=0;i<qnt_nos;i++) {
-        p = new Lista<int>;
-        p->insereFim(i);
-        conjuntoV.insereFim(p);
-        p = nullptr;
-    }
-    // inserindo todas as arestas para ordenar
-    debug("\narestas de E\n");
-    for(i = c = 0; i < qnt_nos; i++) {
-        for (auto it = grafo[i].inicio(); it; it = it->proximo) {
-            Aresta inserir(i, it->dado.id, it->dado.peso);
-            if (!this->existeSimetrico(arvore, c, inserir)) {
-                arvore[c++] = inserir;
-            }
-        }
-    }
-
-    debug("arestas ordenadas em ordem nao decrescente\n");
-    selectionSort(arvore, c);
-
-    for(i = 0; i < c; i++) {
-        debug(arvore[i] << std::endl);
-    }
-
-    conj_u = conj_v = nullptr;
-    for (i = peso = 0; i < qnt_aresta; i++) {
-        // busca os conjuntos que tem os vértices correspondentes
-        for (auto per = conjuntoV.inicio(); per; per = per->proximo) {
-            if (!conj_u) {
-                if (per->dado->acha(arvore[i].inicio)) {
-                    conj_u = per->dado;
-                }
-            }
-            if (!conj_v) {
-                if (per->dado->acha(arvore[i].fim)) {
-                    conj_v = per->dado;
-                }
-            }
-        }
-
-        // se os conjuntos são diferentes
-        if (conj_u && conj_v && (conj_u != conj_v)) {
-            // faz a união dos conjuntos (concatena as 2 listas e exclui a de índice maior)
-            for (auto p = conj_v->inicio(); p; p = p->proximo) {
-                conj_u->insereFim(p->dado);
-            }
-            for (auto it = conjuntoV.inicio(); it; it = it->proximo) {
-                if (!(it->dado != conj_v)) {
-                    conjuntoV.desencadeia(it);
-                    break;
-                }
+int Grafo::extraiArestas(Aresta *v) {
+    int c = 0;
+    for (int i = 0; i < qnt_nos; i++) {
+        for (int e = grafo->inicio(i); e < grafo->fim(i); e++) {
+            if (isOrientado || i < grafo->destino(e)) {
+                v[c++] = Aresta(i, grafo->destino(e), grafo->peso(e));
             }
-            // insere a aresta na árvore pois ela é segura, e guarda o peso dela
-            peso += arvore[i].peso;
-            A.insereFim(arvore[i]);
         }
-        conj_u = conj_v = nullptr;
     }
-
-    std::cout << "peso total: " << peso << "\narestas: ";
-    A.mostrar(" ");
-    delete[] arvore;
+    return c;
 }
 
 /**
@@ -564,6 +559,6 @@ void Grafo::kruskal() {
  * @post Nenhuma
  */
 Grafo::~Grafo() {
-    delete []grafo;
+    descartaGrafo();
     debug("Destruindo um grafo\n");
 }
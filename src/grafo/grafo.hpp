@@ -15,11 +15,15 @@
 #include <fstream>
 #include <string>
 #include <climits>
+#include <vector>
 
 #include "no_grafo.hpp"
 #include "../utils/debug.hpp"
+#include "../utils/instrumentacao.hpp"
 #include "../lista/lista.hpp"
 #include "aresta_kruskal.hpp"
+#include "grafo_csr.hpp"
+#include "indice_lca.hpp"
 
 /**
  * @brief enumera todas as cores possiveis que um vértice
@@ -31,6 +35,50 @@ enum cor {
     PRETO
 };
 
+/**
+ * @brief Posição da busca em profundidade iterativa: o vértice e a
+ * próxima aresta dele a ser explorada
+ */
+struct QuadroDFS {
+    int vertice;
+    int aresta;
+};
+
+/**
+ * @brief enumera os algoritmos que calculam a Árvore Geradora Mínima
+ */
+enum motorAGM {
+    KRUSKAL,
+    FILTER_KRUSKAL,
+    BORUVKA,
+    PRIM,
+    AGM_AUTOMATICO
+};
+
+/**
+ * @brief enumera os algoritmos da busca em largura
+ */
+enum motorBusca {
+    BUSCA_FILA,
+    BUSCA_DIRECAO_OTIMIZADA,
+    BUSCA_PARALELA,
+    BUSCA_AUTOMATICA
+};
+
+/**
+ * @brief enumera os algoritmos que calculam o menor caminho
+ * a partir de um vértice
+ */
+enum motorCaminho {
+    BELLMAN_FORD,
+    BELLMAN_FORD_FILA,
+    BELLMAN_FORD_PARALELO,
+    DIJKSTRA,
+    GOLDBERG_RADZIK,
+    DELTA_STEPPING,
+    CAMINHO_AUTOMATICO
+};
+
 /**
  * @brief define o valor que representa o Nulo para os algoritmos
  * 
@@ -45,19 +93,84 @@ enum cor {
  */
 #define MAX_DIST ((INT_MAX/4) - 1)
 
+/**
+ * @brief Quantidade máxima de baldes do delta-stepping, o delta é
+ * aumentado caso precise de mais
+ */
+#define MAX_BALDES_DELTA (1 << 16)
+
+/**
+ * @brief Quantidade mínima de entradas para o delta-stepping ser
+ * escolhido automaticamente
+ */
+#define MIN_DELTA_STEPPING (1 << 20)
+
+/**
+ * @brief A busca com direção otimizada passa a ser de baixo para cima
+ * quando as arestas da fronteira superam 1 / ALFA_DIRECAO das arestas
+ * dos vértices não visitados
+ */
+#define ALFA_DIRECAO 14
+
+/**
+ * @brief A busca com direção otimizada volta a ser de cima para baixo
+ * quando a fronteira diminui e tem menos de 1 / BETA_DIRECAO dos vértices
+ */
+#define BETA_DIRECAO 24
+
+/**
+ * @brief Quantidade mínima de entradas para a busca com direção otimizada
+ * ser escolhida automaticamente
+ */
+#define MIN_DIRECAO_OTIMIZADA (1 << 16)
+
+/**
+ * @brief Quantidade de consultas de ancestral respondidas antes de
+ * gravar as respostas no arquivo
+ */
+#define BLOCO_CONSULTAS (1 << 20)
+
+/**
+ * @brief Versão atual do arquivo binário da matriz de distâncias
+ */
+#define VERSAO_MATRIZ 1
+
+/**
+ * @brief Quantidade máxima de distâncias calculadas antes de gravar
+ * no arquivo da matriz
+ */
+#define MAX_BLOCO_MATRIZ (1 << 24)
+
+/**
+ * @brief Cabeçalho do arquivo binário da matriz de distâncias
+ *
+ * Logo após o cabeçalho vêm os qnt_linhas vértices de origem e depois
+ * uma linha com as qnt_nos distâncias de cada um deles, todos inteiros
+ * de 32 bits. INT_MAX indica vértice não alcançável
+ */
+struct CabecalhoMatriz {
+    char magica[4];  /// sempre "PAAM"
+    uint32_t versao;  /// VERSAO_MATRIZ
+    int64_t qnt_nos;
+    int64_t qnt_linhas;
+};
+
 /**
  * @brief Classe que representa um único grafo,
  * que sabe encapsula todos os métodos necessários
  * para a operação do mesmo
  * 
- * Utiliza a representação Listas de Adjacência
+ * Utiliza a representação Listas de Adjacência, compactadas
+ * no formato CSR (ver GrafoCSR)
  */
 class Grafo {
     friend class MenuPrincipal;
+    friend class Lote;
+    friend class Benchmark;
     private:
     bool isOrientado; /// booleano que indica se o grafo é orientado
     int qnt_nos;  /// inteiro que indica a quantidade de vértices do grafo
-    Lista<NoGrafo> *grafo;  /// vetor de listas de vértices
+    GrafoCSR *grafo;  /// listas de adjacência no formato CSR
 
     cor *cores;  /// vetor de cores, alocado somente quando tem busca em
     /// profundidade ou largura
@@ -68,9 +181,27 @@ class Grafo {
     int *dist;  /// vetor que informa a distância do vértice até a origem,
     /// utilizado apenas na busca em largura
 
-    Lista<int> ordem;  /// vetor que informa a ordem em que os vértices
+    int *descoberta;  /// tempo em que cada vértice ficou cinza, alocado
+    /// somente quando tem busca em profundidade
+    int *finalizacao;  /// tempo em que cada vértice ficou preto, alocado
+    /// somente quando tem busca em profundidade
+    int tempo;  /// relógio da busca em profundidade
+
+    int *ordem;  /// vetor que informa a ordem em que os vértices
     /// foram acessados, alocado somente quando tem
     /// busca em profundidade ou largura
+    int qnt_ordem;  /// quantidade de vértices em ordem
+
+    GrafoCSR *transposto;  /// grafo com as arestas invertidas, criado
+    /// somente quando alguma busca precisa dele
+
+    IndiceLCA *arvore_busca;  /// árvore da última busca em largura,
+    /// para as consultas de ancestral comum
+
+    bool remove_paralelas;  /// se verdadeiro, ao carregar o grafo mantém
+    /// somente a aresta mais leve entre 2 vértices
+
+    int delta;  /// largura dos baldes do delta-stepping, 0 para automático
 
     /**
      * @brief Constrói um grafo a partir de dados de entrada
@@ -82,20 +213,56 @@ class Grafo {
     void constroi(std::istream& in);
 
     /**
-     * @brief Explora um vértice de cor branca, visitando recursivamente
-     * todos os vértices adjacentes
+     * @brief Constrói um grafo a partir do texto de um arquivo
+     * já carregado na memória
+     *
+     * Mesmo formato de constroi(std::istream&), mas as arestas
+     * são lidas em paralelo
+     * @param inicio primeiro caractere do texto
+     * @param fim posição seguinte ao último caractere do texto
+     * @pre texto no formato de entrada
+     * @post Grafo alocado e contendo os dados do texto
+     */
+    void constroi(const char *inicio, const char *fim);
+
+    /**
+     * @brief Cria o GrafoCSR com as arestas lidas
+     *
+     * As posições do GrafoCSR são int, então grafos com mais entradas
+     * nas listas de adjacência são recusados
+     * @param arestas arestas lidas, o vetor é reaproveitado
+     * @pre qnt_nos e isOrientado definidos
+     * @post grafo alocado, ou nullptr caso seja grande demais
+     */
+    void criaCSR(std::vector<Aresta> &arestas);
+
+    /**
+     * @brief Desaloca o grafo e tudo que foi calculado a partir dele
      *
+     * @pre Nenhuma
+     * @post grafo, transposto e arvore_busca nulos
+     */
+    void descartaGrafo();
+
+    /**
+     * @brief Explora um vértice de cor branca, visitando todos os
+     * vértices alcançáveis a partir dele
+     *
+     * Sem recursão: cada vértice cinza tem um quadro na pilha com a
+     * próxima aresta a ser explorada, assim a ordem de visita é a mesma
+     * da versão recursiva e caminhos longos não estouram a pilha
      * @param index Vértice a ser explorado, cor branca
+     * @param pilha vetor com pelo menos qnt_nos quadros
      * @pre Somente chamado pela buscaEmProfuntidade
      * @post Vértice index totalmente explorado, cor preto
      */
-    void buscaEmProfundidadeVisit(int index);
+    void buscaEmProfundidadeVisit(int index, QuadroDFS *pilha);
 
     /**
-     * @brief Imprime a lista que contém a ordem de acesso dos vértices
+     * @brief Imprime o vetor que contém a ordem de acesso dos vértices
      *
-     * @pre lista ordem alocada
-     * @post lista impressa na saída padrão
+     * @pre vetor ordem preenchido
+     * @post vetor impresso na saída padrão
      */
     void printOrdemAcesso();
 
@@ -115,6 +282,14 @@ class Grafo {
      */
     void printDist();
 
+    /**
+     * @brief Imprime os tempos de descoberta e finalização
+     *
+     * @pre vetores descoberta e finalizacao preenchidos
+     * @post tempos impressos na saída padrão
+     */
+    void printTempos();
+
     /**
      * @brief Utilizado para mostrar na tela o caminho de um
      * vertice origem até um vertice fim utilizando a lista de
@@ -163,18 +338,236 @@ class Grafo {
     bool relax(const int inicio, const int fim, const int peso);
 
     /**
-     * @brief Busca no Vetor de Arestas uma Aresta simétrica
-     * 
-     * somente utilizado para kruskal
-     * @param v Vetor de Arestas
-     * @param tam Tamanho do vetor
-     * @param dado Referência para Aresta a ser buscada
-     * @return true Existe Uma aresta simétrica no vetor
-     * @return false Não existe Uma aresta simétrica no vetor
-     * @pre Vetor de arestas carregado
+     * @brief Calcula dist e predecessores com o algoritmo de Bellman-Ford
+     *
+     * Faz no máximo qnt_nos - 1 passadas por todas as arestas,
+     * parando antes caso uma passada não altere nada
+     * @param origem vértice de origem
+     * @return true Caso não exista ciclo negativo alcançável da origem
+     * @return false Caso exista ciclo negativo alcançável da origem
+     * @pre dist e predecessores alocados
+     * @post dist e predecessores preenchidos
+     */
+    bool calculaBellmanFord(int origem);
+
+    /**
+     * @brief Listas das arestas que chegam em cada vértice
+     *
+     * No grafo não orientado é o próprio grafo, no orientado o transposto
+     * é criado na primeira chamada e guardado
+     * @return const GrafoCSR& arestas invertidas
+     * @pre Grafo carregado
      * @post Nenhuma
      */
-    bool existeSimetrico(Aresta *v, int tam, Aresta &dado);
+    const GrafoCSR &entradas();
+
+    /**
+     * @brief Calcula dist, predecessores e ordem da busca em largura
+     * com uma fila
+     *
+     * @param origem vértice de origem
+     * @pre dist, predecessores e ordem alocados
+     * @post dist, predecessores e ordem preenchidos
+     */
+    void calculaBuscaFila(int origem);
+
+    /**
+     * @brief Calcula dist, predecessores e ordem da busca em largura
+     * com direção otimizada
+     *
+     * Cada nível é expandido de cima para baixo (a fronteira procura os
+     * vizinhos não visitados) ou de baixo para cima (cada vértice não
+     * visitado procura um vizinho na fronteira), com a heurística de
+     * Beamer (ver ALFA_DIRECAO e BETA_DIRECAO). De cima para baixo a
+     * fronteira é o trecho do nível em ordem, de baixo para cima ela é
+     * marcada em um bitmap. Cada nível fica em ordem crescente e o
+     * predecessor é o menor vizinho do nível anterior, nas 2 direções.
+     * As distâncias são idênticas às da calculaBuscaFila
+     * @param origem vértice de origem
+     * @pre dist, predecessores e ordem alocados
+     * @post dist, predecessores e ordem preenchidos
+     */
+    void calculaBuscaDirecaoOtimizada(int origem);
+
+    /**
+     * @brief Calcula dist, predecessores e ordem da busca em largura
+     * em paralelo, um nível por vez
+     *
+     * A fronteira é dividida entre as threads, cada uma guarda os
+     * vértices descobertos em um vetor próprio e o predecessor é marcado
+     * com compare-and-swap, assim cada vértice é descoberto uma única
+     * vez. Os vetores são então copiados em paralelo para o final de
+     * ordem, que é a próxima fronteira. As distâncias são idênticas às da
+     * calculaBuscaFila, a ordem dentro de cada nível e o predecessor
+     * dependem das threads, mas sempre formam uma árvore de busca em
+     * largura
+     * @param origem vértice de origem
+     * @pre dist, predecessores e ordem alocados
+     * @post dist, predecessores e ordem preenchidos
+     */
+    void calculaBuscaParalela(int origem);
+
+    /**
+     * @brief Cria arvore_busca com a árvore da busca em largura a partir
+     * da origem, caso a última não tenha sido a partir dela
+     *
+     * @param origem vértice de origem
+     * @pre Grafo carregado
+     * @post arvore_busca com raiz na origem
+     */
+    void preparaArvoreBusca(int origem);
+
+    /**
+     * @brief Primeiro antecessor comum de u e v na árvore da busca em
+     * largura, sem contar os próprios vértices
+     *
+     * É o menor ancestral comum, ou o predecessor dele quando ele é u ou v
+     * @param u vértice
+     * @param v vértice
+     * @return int o antecessor comum, ou NIL caso não exista
+     * @pre arvore_busca criada
+     * @post Nenhuma
+     */
+    int primeiroAntecessorComum(int u, int v);
+
+    /**
+     * @brief Passadas do Bellman-Ford a partir dos valores atuais de dist
+     *
+     * Faz no máximo qnt_nos - 1 passadas por todas as arestas,
+     * parando antes caso uma passada não altere nada, e depois procura
+     * um ciclo negativo
+     * @return true Caso não exista ciclo negativo alcançável
+     * @return false Caso exista ciclo negativo alcançável
+     * @pre dist e predecessores inicializados
+     * @post dist e predecessores preenchidos
+     */
+    bool passadasBellmanFord();
+
+    /**
+     * @brief Calcula dist e predecessores com o Bellman-Ford baseado
+     * em fila (SPFA)
+     *
+     * Somente as arestas dos vértices cuja distância mudou são relaxadas.
+     * Utiliza as heurísticas SLF (vértice com distância menor que o início
+     * da fila entra no início) e LLL (vértice com distância maior que a
+     * média da fila vai para o fim). Cada vértice guarda quantas arestas
+     * tem o seu caminho atual, um caminho com qnt_nos arestas indica um
+     * ciclo negativo
+     * @param origem vértice de origem
+     * @return true Caso não exista ciclo negativo alcançável da origem
+     * @return false Caso exista ciclo negativo alcançável da origem
+     * @pre dist e predecessores alocados
+     * @post dist e predecessores preenchidos
+     */
+    bool calculaBellmanFordFila(int origem);
+
+    /**
+     * @brief Calcula dist e predecessores com o Bellman-Ford em paralelo
+     *
+     * A cada passada os vértices alterados na passada anterior são
+     * divididos entre as threads, em blocos com a mesma quantidade de
+     * arestas. Distância e predecessor de cada vértice ficam juntos em um
+     * inteiro atômico, assim são sempre atualizados juntos. As distâncias
+     * são idênticas às do calculaBellmanFord, em caso de empate o
+     * predecessor pode ser outro, mas sempre forma uma árvore de
+     * caminhos mínimos
+     * @param origem vértice de origem
+     * @return true Caso não exista ciclo negativo alcançável da origem
+     * @return false Caso exista ciclo negativo alcançável da origem
+     * @pre dist e predecessores alocados
+     * @post dist e predecessores preenchidos
+     */
+    bool calculaBellmanFordParalelo(int origem);
+
+    /**
+     * @brief Calcula dist e predecessores com o algoritmo de Dijkstra,
+     * usando um HeapRadix
+     *
+     * @param origem vértice de origem
+     * @pre dist e predecessores alocados, nenhum peso negativo
+     * @post dist e predecessores preenchidos, distâncias a partir de
+     * MAX_DIST limitadas a MAX_DIST - 1
+     */
+    void calculaDijkstra(int origem);
+
+    /**
+     * @brief Calcula dist e predecessores com o algoritmo de
+     * Goldberg-Radzik, para grafos com pesos negativos
+     *
+     * A cada passada, a partir dos vértices alterados na passada anterior
+     * que têm alguma aresta de custo reduzido (dist[u] + peso - dist[v])
+     * negativo, uma busca em profundidade no grafo das arestas de custo
+     * reduzido <= 0 gera uma ordem topológica, e os vértices são
+     * escaneados nessa ordem. Um ciclo nesse grafo com alguma aresta de
+     * custo reduzido negativo é um ciclo negativo, detectado na hora
+     * @param origem vértice de origem
+     * @return true Caso não exista ciclo negativo alcançável da origem
+     * @return false Caso exista ciclo negativo alcançável da origem
+     * @pre dist e predecessores alocados
+     * @post dist e predecessores preenchidos
+     */
+    bool calculaGoldbergRadzik(int origem);
+
+    /**
+     * @brief Calcula dist e predecessores com o delta-stepping em paralelo
+     *
+     * Os vértices ficam em baldes de largura delta, cada thread com o seu
+     * vetor circular de baldes. O menor balde não vazio é processado em
+     * rodadas: os vértices são divididos entre as threads, que relaxam
+     * as arestas leves (peso <= delta), até o balde não receber mais
+     * vértices. Depois as arestas pesadas dos vértices que saíram do
+     * balde são relaxadas uma única vez. As distâncias são idênticas às
+     * do calculaDijkstra, em caso de empate o predecessor pode ser outro
+     * @param origem vértice de origem
+     * @pre dist e predecessores alocados, nenhum peso negativo
+     * @post dist e predecessores preenchidos
+     */
+    void calculaDeltaStepping(int origem);
+
+    /**
+     * @brief Divide os vértices em blocos com a mesma quantidade de arestas
+     *
+     * @param qnt quantidade de blocos
+     * @return std::vector<int> qnt + 1 limites, o bloco b são os vértices
+     * [limites[b], limites[b + 1])
+     * @pre Grafo carregado
+     * @post Nenhuma
+     */
+    std::vector<int> divideVertices(int qnt);
+
+    /**
+     * @brief Imprime a distância e o caminho de todos os vértices
+     *
+     * @param origem vértice de origem dos caminhos
+     * @param sem_ciclo resultado do algoritmo, se falso somente
+     * informa o ciclo negativo
+     * @pre dist e predecessores preenchidos
+     * @post caminhos impressos na saída padrão
+     */
+    void printCaminhosMinimos(int origem, bool sem_ciclo);
+
+    /**
+     * @brief Copia cada aresta do grafo uma única vez para um vetor
+     *
+     * No grafo não orientado cada aresta aparece nas listas dos 2 vértices,
+     * somente a entrada com início < fim é copiada (laços são ignorados).
+     * As arestas ficam ordenadas por (início, fim)
+     * @param v Vetor de Arestas, com pelo menos qntArestas() posições
+     * @return int quantidade de arestas copiadas
+     * @pre Grafo carregado
+     * @post Nenhuma
+     */
+    int extraiArestas(Aresta *v);
+
+    /**
+     * @brief Imprime a Árvore Geradora Mínima, peso total e arestas
+     *
+     * @param arvore arestas da árvore, na ordem em que foram aceitas
+     * @param qnt quantidade de arestas da árvore
+     * @pre Nenhuma
+     * @post árvore impressa na saída padrão
+     */
+    void printAGM(Aresta *arvore, int qnt);
 
     public:
     /**
@@ -185,6 +578,28 @@ class Grafo {
      */
     Grafo();
 
+    /**
+     * @brief Define se as arestas paralelas devem ser removidas
+     * ao carregar o grafo
+     *
+     * Das arestas com mesmo início e fim é mantida a de menor peso
+     * @param remover verdadeiro para remover as arestas paralelas
+     * @pre Nenhuma
+     * @post Vale para as próximas chamadas de ler
+     */
+    void removerArestasParalelas(bool remover);
+
+    /**
+     * @brief Define a largura dos baldes do delta-stepping
+     *
+     * Sem ser definida, ou com 0, é utilizado o maior peso dividido
+     * pelo grau médio
+     * @param delta largura dos baldes, 0 para automático
+     * @pre delta >= 0
+     * @post Vale para as próximas execuções do delta-stepping
+     */
+    void defineDelta(int delta);
+
     /**
      * @brief Cria o grafo com as informações contidas no arquivo
      * 
@@ -195,6 +610,19 @@ class Grafo {
      */
     void ler(std::string filename);
 
+    /**
+     * @brief Salva o grafo no formato binário, que pode ser lido
+     * novamente com ler sem nenhum processamento
+     *
+     * @param filename o nome do arquivo a ser escrito
+     * @return true se o arquivo foi escrito
+     * @return false caso o grafo não esteja carregado ou ocorra um erro
+     * de escrita
+     * @pre Nenhuma
+     * @post Nenhuma
+     */
+    bool salvar(std::string filename);
+
     /**
      * @brief Cria o grafo com as informações recebidas da entrada padrão
      *
@@ -241,6 +669,58 @@ class Grafo {
      */
     void buscaEmLargura(int vertice_inicio);
 
+    /**
+     * @brief Busca em largura com o algoritmo escolhido
+     *
+     * Imprime o resultado no mesmo formato da buscaEmLargura
+     * @param vertice_inicio deve estar dentro dos limites do vértice
+     * @param motor algoritmo a ser utilizado
+     * @pre Grafo inicializado com ler
+     * @post ordem de visitação vértices impressa na saída padrão
+     */
+    void buscaEmLargura(int vertice_inicio, motorBusca motor);
+
+    /**
+     * @brief Escolhe o algoritmo de busca em largura mais rápido para
+     * o grafo
+     *
+     * A direção otimizada somente compensa em grafos grandes
+     * @return motorBusca BUSCA_DIRECAO_OTIMIZADA ou BUSCA_FILA
+     * @pre Grafo carregado
+     * @post Nenhuma
+     */
+    motorBusca escolheMotorBusca();
+
+    /**
+     * @brief Mostra na tela a profundidade de u e v e o primeiro
+     * antecessor comum dos 2 na árvore da última busca em largura
+     *
+     * @param u vértice
+     * @param v vértice
+     * @pre buscaEmLargura executada
+     * @post Nenhuma
+     */
+    void antecessorComum(int u, int v);
+
+    /**
+     * @brief Responde consultas de menor ancestral comum em lote, na
+     * árvore da busca em largura a partir da origem
+     *
+     * O arquivo de entrada tem um par "u v" por linha, para cada um é
+     * gravada a linha "u v lca profundidade_u profundidade_v", com -1
+     * para vértices fora da árvore. As consultas são respondidas em
+     * paralelo, em blocos de BLOCO_CONSULTAS
+     * @param origem raiz da árvore
+     * @param entrada arquivo com as consultas
+     * @param saida arquivo onde as respostas são gravadas
+     * @return true se todas as consultas foram respondidas
+     * @return false caso algum arquivo não possa ser aberto
+     * @pre Grafo carregado, origem contida no Grafo
+     * @post Nenhuma
+     */
+    bool ancestraisEmLote(int origem, const std::string &entrada,
+                          const std::string &saida);
+
     /**
      * @brief Executa o algoritmo de BellMan-Ford
      *
@@ -257,6 +737,51 @@ class Grafo {
      */
     bool bellmanFord(int vertice_inicio);
 
+    /**
+     * @brief Encontra o menor caminho de todos os vértices em relação
+     * ao vértice passado como argumento, com o algoritmo escolhido
+     *
+     * Imprime o resultado no mesmo formato do bellmanFord
+     * @param vertice_inicio vértice de origem
+     * @param motor algoritmo a ser utilizado
+     * @return true Caso o Grafo não possua um ciclo negativo
+     * @return false Caso o Grafo possua um ciclo negativo
+     * @pre vértice de início está contido no Grafo,
+     *      Grafo carregado
+     * @post Nenhuma
+     */
+    bool caminhoMinimo(int vertice_inicio, motorCaminho motor);
+
+    /**
+     * @brief Escolhe o algoritmo de menor caminho mais rápido para o grafo
+     *
+     * Sem pesos negativos o Dijkstra, ou o delta-stepping quando o grafo
+     * é grande e tem mais de uma thread, caso contrário o Goldberg-Radzik
+     * @return motorCaminho DIJKSTRA, DELTA_STEPPING ou GOLDBERG_RADZIK
+     * @pre Grafo carregado
+     * @post Nenhuma
+     */
+    motorCaminho escolheMotorCaminho();
+
+    /**
+     * @brief Calcula a distância entre todos os pares de vértices com o
+     * algoritmo de Johnson e grava a matriz em um arquivo binário
+     *
+     * Um Bellman-Ford a partir de uma origem virtual ligada a todos os
+     * vértices calcula os potenciais h, que tornam os pesos
+     * peso + h[inicio] - h[fim] não negativos. Depois um Dijkstra é
+     * executado a partir de cada origem, em paralelo com roubo de
+     * trabalho, e as linhas são gravadas em blocos (ver CabecalhoMatriz)
+     * @param filename o nome do arquivo a ser escrito
+     * @param origens vértices de origem das linhas, vazio para todos
+     * @return true se a matriz foi gravada
+     * @return false caso o grafo possua ciclo negativo ou ocorra um erro
+     * de escrita
+     * @pre Grafo carregado, origens contidas no Grafo
+     * @post Nenhuma
+     */
+    bool todosOsPares(const std::string &filename, std::vector<int> origens);
+
     /**
      * @brief Executa o algoritmo de Kruskal
      * 
@@ -267,6 +792,64 @@ class Grafo {
      */
     void kruskal();
 
+    /**
+     * @brief Executa o algoritmo Filter-Kruskal
+     *
+     * Variante do Kruskal que divide as arestas pelo peso de um pivô,
+     * processa primeiro as leves e descarta as pesadas que ligam vértices
+     * já conectados antes de ordená-las. Resultado idêntico ao kruskal
+     * @pre Grafo carregado
+     * @post Nenhuma
+     */
+    void filterKruskal();
+
+    /**
+     * @brief Executa o algoritmo de Borůvka, em paralelo
+     *
+     * A cada rodada todas as threads escolhem a aresta mais leve que sai
+     * de cada componente, e os componentes ligados por elas são contraídos.
+     * Empates de peso são desfeitos pela ordem (início, fim), assim o
+     * resultado é idêntico ao kruskal
+     * @pre Grafo carregado
+     * @post Nenhuma
+     */
+    void boruvka();
+
+    /**
+     * @brief Executa o algoritmo de Prim, com um heap 4-ário indexado
+     *
+     * Cresce uma árvore a partir de cada vértice ainda não alcançado,
+     * formando a floresta geradora mínima. Empates de peso são desfeitos
+     * pelos vértices da aresta, assim o resultado é idêntico ao kruskal
+     * @return true se a árvore foi calculada
+     * @return false se o grafo é orientado
+     * @pre Grafo carregado
+     * @post Nenhuma
+     */
+    bool prim();
+
+    /**
+     * @brief Escolhe o algoritmo de Árvore Geradora Mínima mais rápido
+     * para o grafo, pela densidade
+     *
+     * Grafos não orientados densos (E >= V log V) usam o Prim, que não
+     * precisa ordenar todas as arestas, os demais usam o Kruskal
+     * @return motorAGM PRIM ou KRUSKAL
+     * @pre Grafo carregado
+     * @post Nenhuma
+     */
+    motorAGM escolheMotorAGM();
+
+    /**
+     * @brief Calcula a Árvore Geradora Mínima com o algoritmo escolhido
+     *
+     * @param motor algoritmo a ser utilizado, AGM_AUTOMATICO usa
+     * escolheMotorAGM
+     * @pre Grafo carregado
+     * @post Nenhuma
+     */
+    void arvoreGeradoraMinima(motorAGM motor);
+
     /**
      * @brief Destrutor da classe Grafo
      * 
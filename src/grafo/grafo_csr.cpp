@@ -0,0 +1,268 @@
+/**
+ * @file grafo_csr.cpp
+ * @author Victor Emanuel Almeida e Milena Lucas dos Santos
+ * @brief Implementa todas as funcionalidade da classe GrafoCSR
+ * @version 0.1
+ * @date 17/10/2026
+ */
+
+#include <climits>
+#include <cstring>
+#include <fstream>
+
+#include "grafo_csr.hpp"
+#include "../utils/paralelo.hpp"
+
+/**
+ * @brief Ordem das entradas no CSR, pelo vértice de origem,
+ * depois pelo destino e por último pelo peso
+ */
+static bool menorEntrada(const Aresta &a, const Aresta &b) {
+    if (a.inicio != b.inicio) {
+        return a.inicio < b.inicio;
+    }
+    if (a.fim != b.fim) {
+        return a.fim < b.fim;
+    }
+    return a.peso < b.peso;
+}
+
+/**
+ * @brief Construtor da classe GrafoCSR, cria um grafo vazio
+ *
+ * @pre Nenhuma
+ * @post Nenhuma
+ */
+GrafoCSR::GrafoCSR() {
+    debug("Construindo um GrafoCSR vazio\n");
+    qnt_nos = qnt_entradas = 0;
+    offsets = new int[1];
+    offsets[0] = 0;
+    destinos = nullptr;
+    pesos = nullptr;
+    mapa = nullptr;
+    tem_peso_negativo = false;
+}
+
+/**
+ * @brief Constrói o CSR a partir de todas as arestas lidas
+ *
+ * As arestas são ordenadas uma única vez por (início, fim, peso),
+ * em paralelo quando são muitas, e copiadas para os vetores
+ * @param arestas arestas lidas, em qualquer ordem, o vetor é
+ * reaproveitado para a ordenação
+ * @param qnt_nos quantidade de vértices
+ * @param orientado se falso cada aresta gera 2 entradas
+ * @param remove_paralelas se verdadeiro, das arestas com mesmo início
+ * e fim, mantém somente a de menor peso
+ * @pre todas as arestas com vértices em [0, qnt_nos), no máximo
+ * INT_MAX entradas
+ * @post vetores alocados, destinos de cada vértice em ordem crescente
+ */
+GrafoCSR::GrafoCSR(std::vector<Aresta> &arestas, int qnt_nos, bool orientado,
+                   bool remove_paralelas) {
+    long long i, qnt;
+    debug("Construindo um GrafoCSR a partir de arestas\n");
+    cronometra("construcao");
+    this->qnt_nos = qnt_nos;
+    mapa = nullptr;
+
+    // no grafo não orientado a aresta aparece na lista dos 2 vértices
+    if (!orientado) {
+        qnt = arestas.size();
+        arestas.reserve(2 * qnt);
+        for (i = 0; i < qnt; i++) {
+            arestas.emplace_back(arestas[i].fim, arestas[i].inicio,
+                                 arestas[i].peso);
+        }
+    }
+
+    ordenaParalelo(arestas.data(), arestas.size(), menorEntrada);
+
+    // como o peso também é ordenado, a primeira de cada grupo é a mais leve
+    if (remove_paralelas) {
+        auto fim = std::unique(arestas.begin(), arestas.end(),
+            [](const Aresta &a, const Aresta &b) {
+                return a.inicio == b.inicio && a.fim == b.fim;
+            });
+        arestas.erase(fim, arestas.end());
+    }
+
+    qnt_entradas = arestas.size();
+    offsets  = new int[qnt_nos + 1];
+    destinos = new int[qnt_entradas];
+    pesos    = new int[qnt_entradas];
+
+    // já ordenadas pelo início, basta contar o grau para ter os offsets
+    std::fill(offsets, offsets + qnt_nos + 1, 0);
+    tem_peso_negativo = false;
+    for (i = 0; i < qnt_entradas; i++) {
+        offsets[arestas[i].inicio + 1]++;
+        destinos[i] = arestas[i].fim;
+        pesos[i] = arestas[i].peso;
+        tem_peso_negativo = tem_peso_negativo || (pesos[i] < 0);
+    }
+    for (i = 0; i < qnt_nos; i++) {
+        offsets[i + 1] += offsets[i];
+    }
+}
+
+/**
+ * @brief Verifica se o arquivo começa com o cabeçalho do formato binário
+ *
+ * @param arquivo arquivo já mapeado
+ * @return true se o arquivo está no formato binário
+ * @pre Nenhuma
+ * @post Nenhuma
+ */
+bool GrafoCSR::isBinario(const ArquivoMapeado &arquivo) {
+    return arquivo.tamanho() >= sizeof(CabecalhoBinario) &&
+           memcmp(arquivo.inicio(), "PAAG", 4) == 0;
+}
+
+/**
+ * @brief Carrega um grafo salvo com salvar, sem copiar os vetores
+ *
+ * Os vetores apontam diretamente para o arquivo mapeado na memória,
+ * que fica aberto até o GrafoCSR ser destruído
+ * @param arquivo arquivo já mapeado, passa a pertencer ao GrafoCSR
+ * @param orientado recebe se o grafo salvo é orientado
+ * @return GrafoCSR* o grafo carregado, ou nullptr caso o arquivo
+ * seja inválido (nesse caso o arquivo é desalocado)
+ * @pre arquivo alocado com new
+ * @post Nenhuma
+ */
+GrafoCSR *GrafoCSR::carregar(ArquivoMapeado *arquivo, bool &orientado) {
+    if (!isBinario(*arquivo)) {
+        delete arquivo;
+        return nullptr;
+    }
+    const CabecalhoBinario *cab = (const CabecalhoBinario*)arquivo->inicio();
+    // os vetores são de int, tamanhos maiores não cabem
+    if (cab->versao != VERSAO_BINARIO || cab->qnt_nos < 0 || cab->qnt_nos >= INT_MAX ||
+        cab->qnt_entradas < 0 || cab->qnt_entradas > INT_MAX ||
+        arquivo->tamanho() < sizeof(CabecalhoBinario) +
+            sizeof(int) * (cab->qnt_nos + 1 + 2 * cab->qnt_entradas)) {
+        std::cout << "arquivo binário com versão ou tamanho inválido\n";
+        delete arquivo;
+        return nullptr;
+    }
+
+    // um arquivo corrompido faria as buscas lerem fora dos vetores
+    const int *offsets = (const int*)(arquivo->inicio() + sizeof(CabecalhoBinario));
+    const int *destinos = offsets + cab->qnt_nos + 1;
+    bool valido = offsets[0] == 0 && offsets[cab->qnt_nos] == cab->qnt_entradas;
+    for (int v = 0; valido && v < cab->qnt_nos; v++) {
+        valido = offsets[v] <= offsets[v + 1];
+    }
+    for (int e = 0; valido && e < cab->qnt_entradas; e++) {
+        valido = destinos[e] >= 0 && destinos[e] < cab->qnt_nos;
+    }
+    if (!valido) {
+        std::cout << "arquivo binário com listas de adjacência inválidas\n";
+        delete arquivo;
+        return nullptr;
+    }
+
+    GrafoCSR *g = new GrafoCSR();
+    delete[] g->offsets;
+    orientado = cab->orientado;
+    g->qnt_nos = cab->qnt_nos;
+    g->qnt_entradas = cab->qnt_entradas;
+    g->tem_peso_negativo = cab->flags & FLAG_PESO_NEGATIVO;
+    // o arquivo é somente leitura, mas os vetores nunca são alterados
+    // depois de construídos
+    g->offsets = (int*)(arquivo->inicio() + sizeof(CabecalhoBinario));
+    g->destinos = g->offsets + g->qnt_nos + 1;
+    g->pesos = g->destinos + g->qnt_entradas;
+    g->mapa = arquivo;
+    return g;
+}
+
+/**
+ * @brief Salva o grafo no formato binário
+ *
+ * @param filename o nome do arquivo a ser escrito
+ * @param orientado se o grafo é orientado
+ * @return true se o arquivo foi escrito
+ * @return false caso ocorra um erro de escrita
+ * @pre Nenhuma
+ * @post Nenhuma
+ */
+bool GrafoCSR::salvar(const std::string &filename, bool orientado) const {
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+    CabecalhoBinario cab;
+    memcpy(cab.magica, "PAAG", 4);
+    cab.versao = VERSAO_BINARIO;
+    cab.orientado = orientado;
+    cab.flags = tem_peso_negativo ? FLAG_PESO_NEGATIVO : 0;
+    cab.qnt_nos = qnt_nos;
+    cab.qnt_entradas = qnt_entradas;
+
+    file.write((const char*)&cab, sizeof(cab));
+    file.write((const char*)offsets, sizeof(int) * (qnt_nos + 1));
+    file.write((const char*)destinos, sizeof(int) * qnt_entradas);
+    file.write((const char*)pesos, sizeof(int) * qnt_entradas);
+    return file.good();
+}
+
+/**
+ * @brief Cria o grafo com todas as arestas invertidas
+ *
+ * As entradas de cada vértice continuam em ordem crescente de destino
+ * @return GrafoCSR* grafo transposto, alocado com new
+ * @pre Nenhuma
+ * @post Nenhuma
+ */
+GrafoCSR *GrafoCSR::transposto() const {
+    cronometra("construcao");
+    GrafoCSR *t = new GrafoCSR();
+    delete[] t->offsets;
+    t->qnt_nos = qnt_nos;
+    t->qnt_entradas = qnt_entradas;
+    t->tem_peso_negativo = tem_peso_negativo;
+    t->offsets  = new int[qnt_nos + 1];
+    t->destinos = new int[qnt_entradas];
+    t->pesos    = new int[qnt_entradas];
+
+    // conta o grau de entrada, depois distribui as arestas percorrendo
+    // as origens em ordem crescente
+    std::fill(t->offsets, t->offsets + qnt_nos + 1, 0);
+    for (int e = 0; e < qnt_entradas; e++) {
+        t->offsets[destinos[e] + 1]++;
+    }
+    for (int v = 0; v < qnt_nos; v++) {
+        t->offsets[v + 1] += t->offsets[v];
+    }
+    int *pos = new int[qnt_nos];
+    std::copy(t->offsets, t->offsets + qnt_nos, pos);
+    for (int u = 0; u < qnt_nos; u++) {
+        for (int e = offsets[u]; e < offsets[u + 1]; e++) {
+            int p = pos[destinos[e]]++;
+            t->destinos[p] = u;
+            t->pesos[p] = pesos[e];
+        }
+    }
+    delete[] pos;
+    return t;
+}
+
+/**
+ * @brief Destrutor da classe GrafoCSR
+ *
+ * @pre Nenhuma
+ * @post Vetores desalocados
+ */
+GrafoCSR::~GrafoCSR() {
+    if (mapa) {
+        delete mapa;
+    } else {
+        delete[] offsets;
+        delete[] destinos;
+        delete[] pesos;
+    }
+    debug("Destruindo um GrafoCSR\n");
+}
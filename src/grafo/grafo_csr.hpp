@@ -0,0 +1,212 @@
+/**
+ * @file grafo_csr.hpp
+ * @author Victor Emanuel Almeida e Milena Lucas dos Santos
+ * @brief Define a classe GrafoCSR
+ *
+ * Armazena as listas de adjacência no formato CSR (Compressed Sparse Row):
+ * todas as arestas ficam em vetores contíguos, e o vetor de offsets
+ * indica onde começam as arestas de cada vértice
+ * @version 0.1
+ * @date 17/10/2026
+ */
+
+#ifndef GRAFO_CSR
+#define GRAFO_CSR
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../utils/debug.hpp"
+#include "../utils/instrumentacao.hpp"
+#include "../utils/arquivo_mapeado.hpp"
+#include "aresta_kruskal.hpp"
+
+/**
+ * @brief Versão atual do formato binário, deve ser incrementada
+ * sempre que o layout do arquivo mudar
+ */
+#define VERSAO_BINARIO 2
+
+/**
+ * @brief Bit de CabecalhoBinario::flags que indica se alguma
+ * aresta tem peso negativo
+ */
+#define FLAG_PESO_NEGATIVO 1
+
+/**
+ * @brief Cabeçalho do arquivo binário do grafo
+ *
+ * Logo após o cabeçalho vêm os vetores offsets (qnt_nos + 1 inteiros),
+ * destinos e pesos (qnt_entradas inteiros cada), todos com inteiros de
+ * 32 bits na ordem de bytes da máquina que gravou o arquivo
+ */
+struct CabecalhoBinario {
+    char magica[4];  /// sempre "PAAG"
+    uint32_t versao;  /// VERSAO_BINARIO
+    uint32_t orientado;  /// 1 se o grafo é orientado
+    uint32_t flags;  /// bits FLAG_*
+    int64_t qnt_nos;
+    int64_t qnt_entradas;
+};
+
+/**
+ * @brief Listas de adjacência compactadas em 3 vetores
+ *
+ * As arestas que saem do vértice v são as posições
+ * [offsets[v], offsets[v + 1]) de destinos e pesos
+ */
+class GrafoCSR {
+    friend class Grafo;
+    private:
+    int qnt_nos;  /// quantidade de vértices
+    int qnt_entradas;  /// quantidade de entradas nas listas de adjacência
+    int *offsets;  /// vetor de tamanho qnt_nos + 1
+    int *destinos;  /// vértice de destino de cada entrada
+    int *pesos;  /// peso de cada entrada
+    bool tem_peso_negativo;  /// se alguma entrada tem peso negativo
+    ArquivoMapeado *mapa;  /// arquivo binário de onde os vetores vieram,
+    /// nulo quando os vetores foram alocados
+
+    public:
+    /**
+     * @brief Construtor da classe GrafoCSR, cria um grafo vazio
+     *
+     * @pre Nenhuma
+     * @post Nenhuma
+     */
+    GrafoCSR();
+
+    /**
+     * @brief Constrói o CSR a partir de todas as arestas lidas
+     *
+     * As arestas são ordenadas uma única vez por (início, fim, peso),
+     * em paralelo quando são muitas, e copiadas para os vetores
+     * @param arestas arestas lidas, em qualquer ordem, o vetor é
+     * reaproveitado para a ordenação
+     * @param qnt_nos quantidade de vértices
+     * @param orientado se falso cada aresta gera 2 entradas
+     * @param remove_paralelas se verdadeiro, das arestas com mesmo início
+     * e fim, mantém somente a de menor peso
+     * @pre todas as arestas com vértices em [0, qnt_nos), no máximo
+     * INT_MAX entradas
+     * @post vetores alocados, destinos de cada vértice em ordem crescente
+     */
+    GrafoCSR(std::vector<Aresta> &arestas, int qnt_nos, bool orientado,
+             bool remove_paralelas);
+
+    /**
+     * @brief Verifica se o arquivo começa com o cabeçalho do formato binário
+     *
+     * @param arquivo arquivo já mapeado
+     * @return true se o arquivo está no formato binário
+     * @pre Nenhuma
+     * @post Nenhuma
+     */
+    static bool isBinario(const ArquivoMapeado &arquivo);
+
+    /**
+     * @brief Carrega um grafo salvo com salvar, sem copiar os vetores
+     *
+     * Os vetores apontam diretamente para o arquivo mapeado na memória,
+     * que fica aberto até o GrafoCSR ser destruído
+     * @param arquivo arquivo já mapeado, passa a pertencer ao GrafoCSR
+     * @param orientado recebe se o grafo salvo é orientado
+     * @return GrafoCSR* o grafo carregado, ou nullptr caso o arquivo
+     * seja inválido (nesse caso o arquivo é desalocado)
+     * @pre arquivo alocado com new
+     * @post Nenhuma
+     */
+    static GrafoCSR *carregar(ArquivoMapeado *arquivo, bool &orientado);
+
+    /**
+     * @brief Salva o grafo no formato binário
+     *
+     * @param filename o nome do arquivo a ser escrito
+     * @param orientado se o grafo é orientado
+     * @return true se o arquivo foi escrito
+     * @return false caso ocorra um erro de escrita
+     * @pre Nenhuma
+     * @post Nenhuma
+     */
+    bool salvar(const std::string &filename, bool orientado) const;
+
+    /**
+     * @brief Cria o grafo com todas as arestas invertidas
+     *
+     * As entradas de cada vértice continuam em ordem crescente de destino
+     * @return GrafoCSR* grafo transposto, alocado com new
+     * @pre Nenhuma
+     * @post Nenhuma
+     */
+    GrafoCSR *transposto() const;
+
+    /**
+     * @brief Informa a quantidade de vértices
+     */
+    int qntNos() const {
+        return qnt_nos;
+    }
+
+    /**
+     * @brief Informa a quantidade de entradas das listas de adjacência
+     *
+     * Em um grafo não orientado cada aresta gera 2 entradas
+     */
+    int qntEntradas() const {
+        return qnt_entradas;
+    }
+
+    /**
+     * @brief Informa se alguma aresta tem peso negativo, calculado
+     * ao construir o grafo
+     */
+    bool temPesoNegativo() const {
+        return tem_peso_negativo;
+    }
+
+    /**
+     * @brief Posição da primeira aresta que sai do vértice v
+     */
+    int inicio(int v) const {
+        return offsets[v];
+    }
+
+    /**
+     * @brief Posição seguinte à última aresta que sai do vértice v
+     */
+    int fim(int v) const {
+        return offsets[v + 1];
+    }
+
+    /**
+     * @brief Quantidade de arestas que saem do vértice v
+     */
+    int grau(int v) const {
+        return offsets[v + 1] - offsets[v];
+    }
+
+    /**
+     * @brief Vértice de destino da entrada e
+     */
+    int destino(int e) const {
+        return destinos[e];
+    }
+
+    /**
+     * @brief Peso da entrada e
+     */
+    int peso(int e) const {
+        return pesos[e];
+    }
+
+    /**
+     * @brief Destrutor da classe GrafoCSR
+     *
+     * @pre Nenhuma
+     * @post Vetores desalocados
+     */
+    ~GrafoCSR();
+};
+
+#endif // GRAFO_CSR
@@ -0,0 +1,161 @@
+/**
+ * @file indice_lca.cpp
+ * @author Victor Emanuel Almeida e Milena Lucas dos Santos
+ * @brief Implementa todas as funcionalidade da classe IndiceLCA
+ * @version 0.1
+ * @date 17/10/2026
+ */
+
+#include <algorithm>
+#include <iostream>
+#include <utility>
+
+#include "indice_lca.hpp"
+
+/**
+ * @brief Construtor da classe IndiceLCA
+ *
+ * Somente copia os predecessores, as tabelas são criadas depois
+ * @param predecessores predecessor de cada vértice, NIL na raiz e
+ * nos vértices fora da árvore
+ * @param qnt_nos quantidade de vértices
+ * @param raiz raiz da árvore
+ * @pre predecessores forma uma árvore com raiz em raiz
+ * @post Nenhuma
+ */
+IndiceLCA::IndiceLCA(const int *predecessores, int qnt_nos, int raiz) {
+    debug("Construindo um IndiceLCA\n");
+    this->qnt_nos = qnt_nos;
+    this->raiz = raiz;
+    pai = new int[qnt_nos];
+    std::copy(predecessores, predecessores + qnt_nos, pai);
+    pai[raiz] = -1;
+    prof = pre = tabela = nullptr;
+    qnt_arvore = 0;
+    pronto = false;
+}
+
+/**
+ * @brief Cria a pré-ordem, as profundidades e a sparse table
+ *
+ * Chamado automaticamente na primeira consulta, deve ser chamado antes
+ * de consultar de várias threads ao mesmo tempo
+ * @pre Nenhuma
+ * @post consultas podem ser feitas de várias threads
+ */
+void IndiceLCA::prepara() {
+    if (pronto) {
+        return;
+    }
+    prof = new int[qnt_nos];
+    pre = new int[qnt_nos];
+
+    // filhos de cada vértice no formato CSR
+    int *inicio = new int[qnt_nos + 1];
+    int *filhos = new int[qnt_nos];
+    std::fill(inicio, inicio + qnt_nos + 1, 0);
+    for (int v = 0; v < qnt_nos; v++) {
+        if (pai[v] != -1) {
+            inicio[pai[v] + 1]++;
+        }
+    }
+    for (int v = 0; v < qnt_nos; v++) {
+        inicio[v + 1] += inicio[v];
+    }
+    int *pos = new int[qnt_nos];
+    std::copy(inicio, inicio + qnt_nos, pos);
+    for (int v = 0; v < qnt_nos; v++) {
+        if (pai[v] != -1) {
+            filhos[pos[pai[v]]++] = v;
+        }
+    }
+
+    // pré-ordem iterativa, ordem guarda o vértice de cada posição
+    int *ordem = new int[qnt_nos];
+    int *pilha = pos;
+    int topo = 0;
+    std::fill(prof, prof + qnt_nos, -1);
+    prof[raiz] = 0;
+    pilha[topo++] = raiz;
+    qnt_arvore = 0;
+    while (topo > 0) {
+        int u = pilha[--topo];
+        pre[u] = qnt_arvore;
+        ordem[qnt_arvore++] = u;
+        // empilhados ao contrário para sair em ordem crescente
+        for (int i = inicio[u + 1] - 1; i >= inicio[u]; i--) {
+            prof[filhos[i]] = prof[u] + 1;
+            pilha[topo++] = filhos[i];
+        }
+    }
+
+    // nível 0: pai de cada posição, a raiz nunca é consultada
+    int niveis = 1;
+    while ((1 << niveis) <= qnt_arvore) {
+        niveis++;
+    }
+    tabela = new int[(long long)niveis * qnt_arvore];
+    tabela[0] = raiz;
+    for (int i = 1; i < qnt_arvore; i++) {
+        tabela[i] = pai[ordem[i]];
+    }
+    for (int k = 1; k < niveis; k++) {
+        int *ant = tabela + (long long)(k - 1) * qnt_arvore;
+        int *atual = tabela + (long long)k * qnt_arvore;
+        for (int i = 0; i + (1 << k) <= qnt_arvore; i++) {
+            atual[i] = menor(ant[i], ant[i + (1 << (k - 1))]);
+        }
+    }
+
+    delete[] inicio;
+    delete[] filhos;
+    delete[] pos;
+    delete[] ordem;
+    pronto = true;
+}
+
+/**
+ * @brief Menor ancestral comum de u e v
+ *
+ * Um vértice é ancestral dele mesmo
+ * @param u vértice
+ * @param v vértice
+ * @return int o menor ancestral comum, ou NIL caso algum dos 2 esteja
+ * fora da árvore
+ * @pre u e v em [0, qnt_nos)
+ * @post Nenhuma
+ */
+int IndiceLCA::lca(int u, int v) {
+    if (!pronto) {
+        prepara();
+    }
+    if (!contem(u) || !contem(v)) {
+        return -1;
+    }
+    if (u == v) {
+        return u;
+    }
+    int a = pre[u], b = pre[v];
+    if (a > b) {
+        std::swap(a, b);
+    }
+    // posições (a, b]
+    a++;
+    int k = 31 - __builtin_clz(b - a + 1);
+    return menor(tabela[(long long)k * qnt_arvore + a],
+                 tabela[(long long)k * qnt_arvore + b - (1 << k) + 1]);
+}
+
+/**
+ * @brief Destrutor da classe IndiceLCA
+ *
+ * @pre Nenhuma
+ * @post Vetores desalocados
+ */
+IndiceLCA::~IndiceLCA() {
+    debug("Destruindo um IndiceLCA\n");
+    delete[] pai;
+    delete[] prof;
+    delete[] pre;
+    delete[] tabela;
+}
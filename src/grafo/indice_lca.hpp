@@ -0,0 +1,120 @@
+/**
+ * @file indice_lca.hpp
+ * @author Victor Emanuel Almeida e Milena Lucas dos Santos
+ * @brief Define a classe IndiceLCA
+ *
+ * @version 0.1
+ * @date 17/10/2026
+ */
+
+#ifndef INDICE_LCA
+#define INDICE_LCA
+
+#include "../utils/debug.hpp"
+
+/**
+ * @brief Índice de menor ancestral comum (LCA) de uma árvore dada
+ * pelo vetor de predecessores
+ *
+ * Os vértices são numerados em pré-ordem. Para u != v, com u antes de v
+ * na pré-ordem, o LCA é o pai de menor pré-ordem entre os vértices das
+ * posições (pre[u], pre[v]], encontrado em O(1) com uma sparse table
+ * sobre os pais. As tabelas são criadas na primeira consulta
+ */
+class IndiceLCA {
+    private:
+    int qnt_nos;  /// quantidade de vértices do grafo
+    int raiz;  /// raiz da árvore
+    int *pai;  /// predecessor de cada vértice, NIL na raiz e fora da árvore
+    int *prof;  /// profundidade de cada vértice, -1 fora da árvore
+    int *pre;  /// posição de cada vértice na pré-ordem
+    int *tabela;  /// tabela[k * qnt_arvore + i]: pai de menor pré-ordem
+    /// entre as posições [i, i + 2^k)
+    int qnt_arvore;  /// quantidade de vértices na árvore
+    bool pronto;  /// se as tabelas já foram criadas
+
+    /**
+     * @brief Dos 2 vértices, o de menor pré-ordem
+     */
+    int menor(int a, int b) const {
+        return pre[a] < pre[b] ? a : b;
+    }
+
+    public:
+    /**
+     * @brief Construtor da classe IndiceLCA
+     *
+     * Somente copia os predecessores, as tabelas são criadas depois
+     * @param predecessores predecessor de cada vértice, NIL na raiz e
+     * nos vértices fora da árvore
+     * @param qnt_nos quantidade de vértices
+     * @param raiz raiz da árvore
+     * @pre predecessores forma uma árvore com raiz em raiz
+     * @post Nenhuma
+     */
+    IndiceLCA(const int *predecessores, int qnt_nos, int raiz);
+
+    IndiceLCA(const IndiceLCA &) = delete;
+    IndiceLCA& operator = (const IndiceLCA &) = delete;
+
+    /**
+     * @brief Cria a pré-ordem, as profundidades e a sparse table
+     *
+     * Chamado automaticamente na primeira consulta, deve ser chamado antes
+     * de consultar de várias threads ao mesmo tempo
+     * @pre Nenhuma
+     * @post consultas podem ser feitas de várias threads
+     */
+    void prepara();
+
+    int getRaiz() const {
+        return raiz;
+    }
+
+    /**
+     * @brief Informa se o vértice foi alcançado a partir da raiz
+     */
+    bool contem(int v) const {
+        return v == raiz || pai[v] != -1;
+    }
+
+    /**
+     * @brief Predecessor do vértice na árvore, NIL na raiz
+     */
+    int getPai(int v) const {
+        return pai[v];
+    }
+
+    /**
+     * @brief Profundidade do vértice, -1 caso esteja fora da árvore
+     */
+    int profundidade(int v) {
+        if (!pronto) {
+            prepara();
+        }
+        return prof[v];
+    }
+
+    /**
+     * @brief Menor ancestral comum de u e v
+     *
+     * Um vértice é ancestral dele mesmo
+     * @param u vértice
+     * @param v vértice
+     * @return int o menor ancestral comum, ou NIL caso algum dos 2 esteja
+     * fora da árvore
+     * @pre u e v em [0, qnt_nos)
+     * @post Nenhuma
+     */
+    int lca(int u, int v);
+
+    /**
+     * @brief Destrutor da classe IndiceLCA
+     *
+     * @pre Nenhuma
+     * @post Vetores desalocados
+     */
+    ~IndiceLCA();
+};
+
+#endif // INDICE_LCA
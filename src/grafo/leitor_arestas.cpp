@@ -0,0 +1,142 @@
+/**
+ * @file leitor_arestas.cpp
+ * @author Victor Emanuel Almeida e Milena Lucas dos Santos
+ * @brief Implementa a leitura paralela das arestas
+ * @version 0.1
+ * @date 17/10/2026
+ */
+
+#include <charconv>
+#include <cstring>
+#include <string>
+
+#include "leitor_arestas.hpp"
+#include "../utils/paralelo.hpp"
+
+/**
+ * @brief Tamanho mínimo do bloco lido por uma thread, abaixo disso
+ * criar as threads custa mais que ler o texto
+ */
+#define MIN_BLOCO_LEITURA (1 << 20)
+
+/**
+ * @brief Avança p até o primeiro caractere da próxima linha
+ */
+static const char *proximaLinha(const char *p, const char *fim) {
+    const char *nl = (const char*)memchr(p, '\n', fim - p);
+    return nl ? nl + 1 : fim;
+}
+
+/**
+ * @brief Lê um inteiro, ignorando o que vem antes dele na linha
+ *
+ * @return true se um inteiro foi lido antes do fim da linha
+ */
+static bool leInteiro(const char *&p, const char *fim, int &valor) {
+    while (p < fim && *p != '\n' && *p != '-' && (*p < '0' || *p > '9')) {
+        p++;
+    }
+    auto res = std::from_chars(p, fim, valor);
+    if (res.ec != std::errc()) {
+        return false;
+    }
+    p = res.ptr;
+    return true;
+}
+
+/**
+ * @brief Lê as arestas de um bloco de linhas completas
+ */
+static void leBloco(const char *p, const char *fim,
+                    std::vector<Aresta> &arestas) {
+    Aresta temp;
+    while (p < fim) {
+        const char *fim_linha = (const char*)memchr(p, '\n', fim - p);
+        if (!fim_linha) {
+            fim_linha = fim;
+        }
+        if (leInteiro(p, fim_linha, temp.inicio) &&
+            leInteiro(p, fim_linha, temp.fim) &&
+            leInteiro(p, fim_linha, temp.peso)) {
+            arestas.push_back(temp);
+        }
+        p = (fim_linha < fim) ? fim_linha + 1 : fim;
+    }
+}
+
+/**
+ * @brief Lê o valor de uma linha de cabeçalho "nome=valor"
+ *
+ * @param p posição atual da leitura, avança até a próxima linha
+ * @param fim fim do texto
+ * @param valor recebe o texto depois do '=', sem o fim de linha
+ * @return true se uma linha foi lida
+ * @return false se o texto acabou
+ * @pre Nenhuma
+ * @post Nenhuma
+ */
+bool leCabecalho(const char *&p, const char *fim, std::string &valor) {
+    if (p >= fim) {
+        return false;
+    }
+    const char *prox = proximaLinha(p, fim);
+    const char *igual = (const char*)memchr(p, '=', prox - p);
+    const char *fim_valor = prox;
+    while (fim_valor > p && (fim_valor[-1] == '\n' || fim_valor[-1] == '\r')) {
+        fim_valor--;
+    }
+    valor.assign(igual ? igual + 1 : p, fim_valor);
+    p = prox;
+    return true;
+}
+
+/**
+ * @brief Lê todas as arestas de um texto no formato "(u,v):w",
+ * uma por linha
+ *
+ * O texto é dividido em blocos que terminam em fim de linha, cada bloco
+ * é lido por uma thread e no final os resultados são concatenados,
+ * mantendo a ordem do texto
+ * @param inicio primeiro caractere da primeira linha de arestas
+ * @param fim fim do texto
+ * @param arestas vetor que recebe as arestas lidas
+ * @pre Nenhuma
+ * @post arestas contém todas as arestas do texto
+ */
+void leArestas(const char *inicio, const char *fim,
+               std::vector<Aresta> &arestas) {
+    long long tam = fim - inicio;
+    int t = std::max(1, (int)std::min<long long>(qntThreads(),
+                                                 tam / MIN_BLOCO_LEITURA));
+
+    // os limites dos blocos são levados para o início da linha seguinte
+    std::vector<const char*> limites(t + 1);
+    limites[0] = inicio;
+    limites[t] = fim;
+    for (int i = 1; i < t; i++) {
+        limites[i] = proximaLinha(inicio + tam * i / t, fim);
+    }
+
+    std::vector<std::vector<Aresta>> blocos(t);
+    paraleloPara(t, [&](int, long long ini, long long fim_bloco) {
+        for (long long b = ini; b < fim_bloco; b++) {
+            // estimativa de 10 bytes por linha, evita realocações
+            blocos[b].reserve((limites[b + 1] - limites[b]) / 10);
+            leBloco(limites[b], limites[b + 1], blocos[b]);
+        }
+    });
+
+    // junta os blocos, cada thread copia o seu
+    std::vector<size_t> offsets(t + 1, arestas.size());
+    for (int i = 0; i < t; i++) {
+        offsets[i + 1] = offsets[i] + blocos[i].size();
+    }
+    arestas.resize(offsets[t]);
+    paraleloPara(t, [&](int, long long ini, long long fim_bloco) {
+        for (long long b = ini; b < fim_bloco; b++) {
+            std::copy(blocos[b].begin(), blocos[b].end(),
+                      arestas.begin() + offsets[b]);
+            std::vector<Aresta>().swap(blocos[b]);
+        }
+    });
+}
@@ -0,0 +1,47 @@
+/**
+ * @file leitor_arestas.hpp
+ * @author Victor Emanuel Almeida e Milena Lucas dos Santos
+ * @brief Leitura paralela das arestas no formato "(u,v):w"
+ *
+ * @version 0.1
+ * @date 17/10/2026
+ */
+
+#ifndef LEITOR_ARESTAS
+#define LEITOR_ARESTAS
+
+#include <string>
+#include <vector>
+
+#include "aresta_kruskal.hpp"
+
+/**
+ * @brief Lê o valor de uma linha de cabeçalho "nome=valor"
+ *
+ * @param p posição atual da leitura, avança até a próxima linha
+ * @param fim fim do texto
+ * @param valor recebe o texto depois do '=', sem o fim de linha
+ * @return true se uma linha foi lida
+ * @return false se o texto acabou
+ * @pre Nenhuma
+ * @post Nenhuma
+ */
+bool leCabecalho(const char *&p, const char *fim, std::string &valor);
+
+/**
+ * @brief Lê todas as arestas de um texto no formato "(u,v):w",
+ * uma por linha
+ *
+ * O texto é dividido em blocos que terminam em fim de linha, cada bloco
+ * é lido por uma thread e no final os resultados são concatenados,
+ * mantendo a ordem do texto
+ * @param inicio primeiro caractere da primeira linha de arestas
+ * @param fim fim do texto
+ * @param arestas vetor que recebe as arestas lidas
+ * @pre Nenhuma
+ * @post arestas contém todas as arestas do texto
+ */
+void leArestas(const char *inicio, const char *fim,
+               std::vector<Aresta> &arestas);
+
+#endif // LEITOR_ARESTAS
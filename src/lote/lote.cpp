@@ -0,0 +1,307 @@
+/**
+ * @file lote.cpp
+ * @author Victor Emanuel Almeida e Milena Lucas dos Santos
+ * @brief Implementa todas as funcionalidade da classe Lote
+ * @version 0.1
+ * @date 17/10/2026
+ */
+
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#include "lote.hpp"
+
+/**
+ * @brief Nome de um algoritmo no roteiro e o valor do enum dele
+ */
+struct NomeMotor {
+    const char *nome;
+    int motor;
+};
+
+static const NomeMotor MOTORES_BUSCA[] = {
+    {"fila", BUSCA_FILA},
+    {"direcao", BUSCA_DIRECAO_OTIMIZADA},
+    {"paralela", BUSCA_PARALELA},
+    {"auto", BUSCA_AUTOMATICA},
+};
+
+static const NomeMotor MOTORES_CAMINHO[] = {
+    {"bellman-ford", BELLMAN_FORD},
+    {"spfa", BELLMAN_FORD_FILA},
+    {"bellman-ford-paralelo", BELLMAN_FORD_PARALELO},
+    {"dijkstra", DIJKSTRA},
+    {"goldberg-radzik", GOLDBERG_RADZIK},
+    {"delta-stepping", DELTA_STEPPING},
+    {"auto", CAMINHO_AUTOMATICO},
+};
+
+static const NomeMotor MOTORES_AGM[] = {
+    {"kruskal", KRUSKAL},
+    {"filter-kruskal", FILTER_KRUSKAL},
+    {"boruvka", BORUVKA},
+    {"prim", PRIM},
+    {"auto", AGM_AUTOMATICO},
+};
+
+/**
+ * @brief Procura o algoritmo pelo nome, o último da tabela é o padrão
+ * quando não tem nome
+ *
+ * @param tabela nomes dos algoritmos
+ * @param nome nome lido do roteiro, vazio para o padrão
+ * @param motor valor do algoritmo encontrado
+ * @return true se o nome existe na tabela
+ */
+template <size_t N>
+static bool procuraMotor(const NomeMotor (&tabela)[N], const std::string &nome,
+                         int &motor) {
+    if (nome.empty()) {
+        motor = tabela[N - 1].motor;
+        return true;
+    }
+    for (const NomeMotor &m : tabela) {
+        if (nome == m.nome) {
+            motor = m.motor;
+            return true;
+        }
+    }
+    return false;
+}
+
+Lote::Lote(Grafo *g) {
+    debug("Construindo Lote\n");
+    this->g = g;
+    linha = 0;
+}
+
+/**
+ * @brief Mostra um erro na saída de erro, com a linha do roteiro
+ */
+void Lote::erro(const std::string &mensagem) const {
+    std::cerr << "linha " << linha << ": " << mensagem << '\n';
+}
+
+/**
+ * @brief Lê um vértice dos argumentos e confere os limites
+ *
+ * @param args argumentos do comando
+ * @param v vértice lido
+ * @return true se o vértice é válido
+ * @pre Nenhuma
+ * @post Nenhuma
+ */
+bool Lote::leVertice(std::istringstream &args, int &v) {
+    if (!(args >> v)) {
+        erro("vértice ausente");
+        return false;
+    }
+    if (v < 0 || v >= g->qnt_nos) {
+        erro("vértice inválido " + std::to_string(v));
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Executa um único comando
+ *
+ * @param comando nome do comando
+ * @param args argumentos do comando
+ * @return true se o comando foi executado
+ * @pre Grafo carregado
+ * @post resultado impresso na saída padrão
+ */
+bool Lote::executaComando(const std::string &comando, std::istringstream &args) {
+    int v, motor;
+    std::string nome;
+
+    if (comando == "bfs") {
+        if (!leVertice(args, v)) {
+            return false;
+        }
+        args >> nome;
+        if (!procuraMotor(MOTORES_BUSCA, nome, motor)) {
+            erro("algoritmo de busca desconhecido " + nome);
+            return false;
+        }
+        g->buscaEmLargura(v, (motorBusca)motor);
+        return true;
+    }
+    if (comando == "dfs") {
+        if (!leVertice(args, v)) {
+            return false;
+        }
+        g->buscaEmProfundidade(v);
+        return true;
+    }
+    if (comando == "sssp") {
+        if (!leVertice(args, v)) {
+            return false;
+        }
+        args >> nome;
+        if (!procuraMotor(MOTORES_CAMINHO, nome, motor)) {
+            erro("algoritmo de menor caminho desconhecido " + nome);
+            return false;
+        }
+        // no grafo não orientado uma aresta negativa já é um ciclo
+        if (!g->isOrientado && g->grafo->temPesoNegativo()) {
+            erro("grafo não orientado com pesos negativos, algoritmo não atende ao requisito");
+            return false;
+        }
+        // o caminhoMinimo também recusa, mas o retorno dele indica ciclo
+        // negativo, que é um resultado válido
+        if ((motor == DIJKSTRA || motor == DELTA_STEPPING) && g->grafo->temPesoNegativo()) {
+            erro("grafo com pesos negativos, algoritmo não atende ao requisito");
+            return false;
+        }
+        g->caminhoMinimo(v, (motorCaminho)motor);
+        return true;
+    }
+    if (comando == "delta") {
+        if (!(args >> v) || v < 0) {
+            erro("largura dos baldes inválida");
+            return false;
+        }
+        g->defineDelta(v);
+        return true;
+    }
+    if (comando == "mst") {
+        args >> nome;
+        if (!procuraMotor(MOTORES_AGM, nome, motor)) {
+            erro("algoritmo de árvore geradora desconhecido " + nome);
+            return false;
+        }
+        if (motor == PRIM && g->isOrientado) {
+            erro("grafo orientado, algoritmo não atende ao requisito");
+            return false;
+        }
+        g->arvoreGeradoraMinima((motorAGM)motor);
+        return true;
+    }
+    if (comando == "lca") {
+        int u, w;
+        if (!leVertice(args, v) || !leVertice(args, u) || !leVertice(args, w)) {
+            return false;
+        }
+        g->preparaArvoreBusca(v);
+        IndiceLCA *arvore = g->arvore_busca;
+        std::cout << u << ' ' << w << ' ' << arvore->lca(u, w) << ' '
+                  << arvore->profundidade(u) << ' ' << arvore->profundidade(w) << '\n';
+        return true;
+    }
+    if (comando == "ancestrais") {
+        std::string entrada, saida;
+        if (!leVertice(args, v)) {
+            return false;
+        }
+        if (!(args >> entrada >> saida)) {
+            erro("esperado: ancestrais <raiz> <consultas> <respostas>");
+            return false;
+        }
+        if (!g->ancestraisEmLote(v, entrada, saida)) {
+            erro("não foi possível abrir " + entrada + " ou " + saida);
+            return false;
+        }
+        std::cout << "Respostas salvas em " << saida << '\n';
+        return true;
+    }
+    if (comando == "apsp") {
+        std::string saida;
+        if (!(args >> saida)) {
+            erro("esperado: apsp <matriz> [origens...]");
+            return false;
+        }
+        std::vector<int> origens;
+        args >> std::ws;
+        while (!args.eof()) {
+            if (!leVertice(args, v)) {
+                return false;
+            }
+            origens.push_back(v);
+            args >> std::ws;
+        }
+        if (!g->todosOsPares(saida, origens)) {
+            erro("não foi possível gerar a matriz " + saida);
+            return false;
+        }
+        std::cout << "Matriz salva em " << saida << '\n';
+        return true;
+    }
+    erro("comando desconhecido " + comando);
+    return false;
+}
+
+/**
+ * @brief Executa todos os comandos do roteiro
+ *
+ * Um comando inválido não interrompe os seguintes
+ * @param roteiro comandos, um por linha
+ * @return int quantidade de comandos que falharam, -1 caso o grafo
+ * não esteja carregado
+ * @pre Nenhuma
+ * @post resultados impressos na saída padrão
+ */
+int Lote::executa(std::istream &roteiro) {
+    int falhas = 0;
+    std::string texto, comando;
+    linha = 0;
+    if (g->grafo == nullptr) {
+        std::cerr << "Grafo não inicializado\n";
+        return -1;
+    }
+    while (std::getline(roteiro, texto)) {
+        linha++;
+        std::istringstream args(texto);
+        if (!(args >> comando) || comando[0] == '#') {
+            continue;
+        }
+        std::cout << "== " << texto << '\n';
+        if (!executaComando(comando, args)) {
+            falhas++;
+        }
+    }
+    std::cout.flush();
+    return falhas;
+}
+
+/**
+ * @brief Executa o roteiro de um arquivo, gravando os resultados
+ *
+ * @param roteiro arquivo com os comandos, - para a entrada padrão
+ * @param saida arquivo dos resultados, vazio para a saída padrão
+ * @return int quantidade de comandos que falharam, -1 caso algum
+ * arquivo não possa ser aberto
+ * @pre Grafo carregado
+ * @post Nenhuma
+ */
+int Lote::executa(const std::string &roteiro, const std::string &saida) {
+    std::ifstream arquivo;
+    if (roteiro != "-") {
+        arquivo.open(roteiro);
+        if (!arquivo.is_open()) {
+            std::cerr << "Não foi possível abrir " << roteiro << '\n';
+            return -1;
+        }
+    }
+    std::istream &entrada = roteiro == "-" ? std::cin : arquivo;
+    if (saida.empty()) {
+        return executa(entrada);
+    }
+
+    std::ofstream resultado(saida);
+    if (!resultado.is_open()) {
+        std::cerr << "Não foi possível escrever em " << saida << '\n';
+        return -1;
+    }
+    // os algoritmos imprimem em std::cout, que passa a escrever no arquivo
+    std::streambuf *antigo = std::cout.rdbuf(resultado.rdbuf());
+    int falhas = executa(entrada);
+    std::cout.rdbuf(antigo);
+    return falhas;
+}
+
+Lote::~Lote() {
+    debug("Destruindo Lote\n");
+}
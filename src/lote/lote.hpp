@@ -0,0 +1,100 @@
+/**
+ * @file lote.hpp
+ * @author Victor Emanuel Almeida e Milena Lucas dos Santos
+ * @brief Define a classe Lote
+ *
+ * @version 0.1
+ * @date 17/10/2026
+ */
+
+#ifndef LOTE
+#define LOTE
+
+#include <istream>
+#include <sstream>
+#include <string>
+#include "../utils/debug.hpp"
+#include "../grafo/grafo.hpp"
+
+/**
+ * @brief Executa um roteiro de consultas sobre um grafo já carregado,
+ * sem interação com o terminal
+ *
+ * Cada linha do roteiro é um comando, linhas vazias e iniciadas por #
+ * são ignoradas:
+ *  - bfs <origem> [fila|direcao|paralela|auto]
+ *  - dfs <origem>
+ *  - sssp <origem> [bellman-ford|spfa|bellman-ford-paralelo|dijkstra|
+ *    goldberg-radzik|delta-stepping|auto]
+ *  - delta <largura>, largura dos baldes do delta-stepping, 0 é automático
+ *  - mst [kruskal|filter-kruskal|boruvka|prim|auto]
+ *  - lca <raiz> <u> <v>, imprime "u v lca profundidade_u profundidade_v"
+ *  - ancestrais <raiz> <consultas> <respostas>, ver Grafo::ancestraisEmLote
+ *  - apsp <matriz> [origens...], ver Grafo::todosOsPares
+ *
+ * O resultado de cada comando vem depois da linha "== <comando>", os
+ * erros vão para a saída de erro
+ */
+class Lote {
+    private:
+    Grafo *g;
+    int linha;  /// número da linha atual do roteiro, para os erros
+
+    /**
+     * @brief Lê um vértice dos argumentos e confere os limites
+     *
+     * @param args argumentos do comando
+     * @param v vértice lido
+     * @return true se o vértice é válido
+     * @pre Nenhuma
+     * @post Nenhuma
+     */
+    bool leVertice(std::istringstream &args, int &v);
+
+    /**
+     * @brief Mostra um erro na saída de erro, com a linha do roteiro
+     */
+    void erro(const std::string &mensagem) const;
+
+    /**
+     * @brief Executa um único comando
+     *
+     * @param comando nome do comando
+     * @param args argumentos do comando
+     * @return true se o comando foi executado
+     * @pre Grafo carregado
+     * @post resultado impresso na saída padrão
+     */
+    bool executaComando(const std::string &comando, std::istringstream &args);
+
+    public:
+    Lote(Grafo *g);
+
+    /**
+     * @brief Executa todos os comandos do roteiro
+     *
+     * Um comando inválido não interrompe os seguintes
+     * @param roteiro comandos, um por linha
+     * @return int quantidade de comandos que falharam, -1 caso o grafo
+     * não esteja carregado
+     * @pre Nenhuma
+     * @post resultados impressos na saída padrão
+     */
+    int executa(std::istream &roteiro);
+
+    /**
+     * @brief Executa o roteiro de um arquivo, gravando os resultados
+     *
+     * @param roteiro arquivo com os comandos, - para a entrada padrão
+     * @param saida arquivo dos resultados, vazio para a saída padrão
+     * @return int quantidade de comandos que falharam, -1 caso algum
+     * arquivo não possa ser aberto
+     * @pre Grafo carregado
+     * @post Nenhuma
+     */
+    int executa(const std::string &roteiro, const std::string &saida);
+
+    ~Lote();
+};
+
+#endif // LOTE
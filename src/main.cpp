@@ -4,17 +4,46 @@
 #include "grafo/no_grafo.hpp"
 #include "lista/lista.hpp"
 #include "utils/debug.hpp"
+#include "utils/instrumentacao.hpp"
 #include "menu/menu_principal.hpp"
+#include "lote/lote.hpp"
 
 using namespace std;
 
 int main (int argc, char *argv[]) {
     Grafo g;
+    // converte um arquivo texto para o formato binário e sai
+    if (argc == 4 && string(argv[1]) == "--converte") {
+        g.ler(argv[2]);
+        if (!g.salvar(argv[3])) {
+            cout << "Não foi possível salvar o grafo em " << argv[3] << '\n';
+            return 1;
+        }
+        return 0;
+    }
+    // executa um roteiro de consultas sem o menu:
+    // main.out <grafo> --lote <roteiro> [--saida <arquivo>]
+    if ((argc == 4 || argc == 6) && string(argv[2]) == "--lote") {
+        string saida;
+        if (argc == 6) {
+            if (string(argv[4]) != "--saida") {
+                cout << "Uso: " << argv[0] << " <grafo> --lote <roteiro> [--saida <arquivo>]\n";
+                return 1;
+            }
+            saida = argv[5];
+        }
+        g.ler(argv[1]);
+        Lote lote(&g);
+        int falhas = lote.executa(argv[3], saida);
+        relatorioInstrumentacao();
+        return falhas == 0 ? 0 : 1;
+    }
     if (argc == 2) {
         g.ler(argv[1]);
     }
     MenuPrincipal menu (&g);
     menu.loop();
+    relatorioInstrumentacao();
 
     return 0;
 }
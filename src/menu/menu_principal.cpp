@@ -19,11 +19,14 @@ void MenuPrincipal::mostrar() const {
             << "|                                                  |\n"
             << "|                  1.  Busca em Profundidade       |\n"
             << "|                  2.  Busca em Largura            |\n"
-            << "|                  3.  Bellmain-Ford               |\n"
-            << "|                  4.  Kruskal                     |\n"
+            << "|                  3.  Menor Caminho               |\n"
+            << "|                  4.  Árvore Geradora Mínima      |\n"
             << "|                  5.  Carregar grafo              |\n"
             << "|                  6.  Mostrar Grafo               |\n"
             << "|                  7.  Sair                        |\n"
+            << "|                  8.  Salvar grafo (binário)      |\n"
+            << "|                  9.  Distância entre todos pares |\n"
+            << "|                  a.  Ancestral comum em lote     |\n"
             << "|--------------------------------------------------|\n\n\n";
 }
 
@@ -86,7 +89,7 @@ void MenuPrincipal::loop() {
     using namespace std;
 
     char entrada = 0;
-    int verticeInicial;
+    int verticeInicial, algoritmo;
     string s;
 
     while (entrada != ESC) {
@@ -104,7 +107,7 @@ void MenuPrincipal::loop() {
                 cout << "Busca em profundidade\n";
                 cout << "Digite o vértice inicial: ";
                 cin >> verticeInicial;
-                while (verticeInicial < 0 || verticeInicial > g->qnt_nos){
+                while (verticeInicial < 0 || verticeInicial >= g->qnt_nos){
                     cout << "Vértice inválido. Digite novamente: \n";
                     cin >> verticeInicial;
                 }
@@ -123,11 +126,24 @@ void MenuPrincipal::loop() {
                 cout << "Busca em Largura\n";
                 cout << "Digite o vértice inicial: ";
                 cin >> verticeInicial;
-                while (verticeInicial < 0 || verticeInicial > g->qnt_nos){
+                while (verticeInicial < 0 || verticeInicial >= g->qnt_nos){
                     cout << "Vértice inválido. Digite novamente: \n";
                     cin >> verticeInicial;
                 }
-                g->buscaEmLargura(verticeInicial);
+                cout << "1. Fila  2. Direção otimizada  3. Paralela  4. Automático\n";
+                cout << "Digite o algoritmo: ";
+                cin >> algoritmo;
+                while (algoritmo < 1 || algoritmo > 4) {
+                    cout << "Algoritmo inválido. Digite novamente: \n";
+                    cin >> algoritmo;
+                }
+                g->buscaEmLargura(verticeInicial, (motorBusca)(algoritmo - 1));
+                {
+                    int u, v;
+                    cout << "entre com 2 vértices: ";
+                    cin >> u >> v;
+                    g->antecessorComum(u, v);
+                }
                 cout << "\nDigite ENTER para voltar ao menu\n";
                 getChar();
                 break;
@@ -139,27 +155,57 @@ void MenuPrincipal::loop() {
                     getChar();
                     break;
                 }
-                if (!this->g->isOrientado) {
-                    cout << "Grafo não orientado, algoritmo não atende ao requisito\n";
+                // no grafo não orientado uma aresta negativa já é um ciclo
+                if (!this->g->isOrientado && g->grafo->temPesoNegativo()) {
+                    cout << "Grafo não orientado com pesos negativos, algoritmo não atende ao requisito\n";
                     cout << "\nDigite ENTER para voltar ao menu\n";
                     getChar();
                     break;
                 }
-                cout << "Bellman-Ford\n";
+                cout << "Menor Caminho\n";
                 cout << "Digite o vértice inicial: ";
                 cin >> verticeInicial;
-                while (verticeInicial < 0 || verticeInicial > g->qnt_nos){
+                while (verticeInicial < 0 || verticeInicial >= g->qnt_nos){
                     cout << "Vértice inválido. Digite novamente: \n";
                     cin >> verticeInicial;
                 }
-                g->bellmanFord(verticeInicial);
+                cout << "1. Bellman-Ford  2. Bellman-Ford com fila (SPFA)\n"
+                     << "3. Bellman-Ford paralelo  4. Dijkstra  5. Goldberg-Radzik\n"
+                     << "6. Delta-stepping (paralelo)  7. Automático\n";
+                cout << "Digite o algoritmo: ";
+                cin >> algoritmo;
+                while (algoritmo < 1 || algoritmo > 7) {
+                    cout << "Algoritmo inválido. Digite novamente: \n";
+                    cin >> algoritmo;
+                }
+                if (algoritmo - 1 == DELTA_STEPPING) {
+                    int delta;
+                    cout << "Digite a largura dos baldes (0 para automático): ";
+                    cin >> delta;
+                    g->defineDelta(delta < 0 ? 0 : delta);
+                }
+                g->caminhoMinimo(verticeInicial, (motorCaminho)(algoritmo - 1));
                 cout << "\nDigite ENTER para voltar ao menu\n";
                 getChar();
                 break;
 
             case '4':
-                cout << "Kruskal\n";
-                g->kruskal();
+                if (g->grafo == nullptr) {
+                    cout << "Grafo não inicializado\n";
+                    cout << "\nDigite ENTER para voltar ao menu\n";
+                    getChar();
+                    break;
+                }
+                cout << "Árvore Geradora Mínima\n";
+                cout << "1. Kruskal  2. Filter-Kruskal  3. Borůvka (paralelo)\n"
+                     << "4. Prim  5. Automático\n";
+                cout << "Digite o algoritmo: ";
+                cin >> algoritmo;
+                while (algoritmo < 1 || algoritmo > 5) {
+                    cout << "Algoritmo inválido. Digite novamente: \n";
+                    cin >> algoritmo;
+                }
+                g->arvoreGeradoraMinima((motorAGM)(algoritmo - 1));
                 cout << "\nDigite ENTER para voltar ao menu\n";
                 getChar();
                 break;
@@ -167,7 +213,7 @@ void MenuPrincipal::loop() {
             case '5':
                 if(g->grafo != nullptr){
                     cout << "Desalocando grafo\n";
-                    delete[] g->grafo;
+                    g->descartaGrafo();
                 }
                 cout << "Carregar Grafo\n";
                 cout << "Informe o caminho para o arquivo: ";
@@ -189,6 +235,89 @@ void MenuPrincipal::loop() {
                 cout << "Encerrando o programa\n";
                 return;
 
+            case '8':
+                if (g->grafo == nullptr) {
+                    cout << "Grafo não inicializado\n";
+                    cout << "\nDigite ENTER para voltar ao menu\n";
+                    getChar();
+                    break;
+                }
+                cout << "Salvar Grafo\n";
+                cout << "Informe o caminho para o arquivo: ";
+                cin >> s;
+                if (g->salvar(s)) {
+                    cout << "Grafo salvo em " << s << '\n';
+                } else {
+                    cout << "Não foi possível escrever em " << s << '\n';
+                }
+                cout << "\nDigite ENTER para voltar ao menu\n";
+                getChar();
+                break;
+
+            case '9':
+                if (g->grafo == nullptr) {
+                    cout << "Grafo não inicializado\n";
+                    cout << "\nDigite ENTER para voltar ao menu\n";
+                    getChar();
+                    break;
+                }
+                cout << "Distância entre todos os pares (Johnson)\n";
+                cout << "Quantidade de vértices de origem (0 para todos): ";
+                cin >> algoritmo;
+                {
+                    vector<int> origens;
+                    for (int i = 0; i < algoritmo; i++) {
+                        cout << "Digite o vértice de origem: ";
+                        cin >> verticeInicial;
+                        while (verticeInicial < 0 || verticeInicial >= g->qnt_nos) {
+                            cout << "Vértice inválido. Digite novamente: \n";
+                            cin >> verticeInicial;
+                        }
+                        origens.push_back(verticeInicial);
+                    }
+                    cout << "Informe o caminho para o arquivo da matriz: ";
+                    cin >> s;
+                    if (g->todosOsPares(s, origens)) {
+                        cout << "Matriz salva em " << s << '\n';
+                    } else {
+                        cout << "Não foi possível gerar a matriz\n";
+                    }
+                }
+                cout << "\nDigite ENTER para voltar ao menu\n";
+                getChar();
+                break;
+
+            case 'a':
+            case 'A':
+                if (g->grafo == nullptr) {
+                    cout << "Grafo não inicializado\n";
+                    cout << "\nDigite ENTER para voltar ao menu\n";
+                    getChar();
+                    break;
+                }
+                cout << "Ancestral comum em lote\n";
+                cout << "Digite a raiz da busca em largura: ";
+                cin >> verticeInicial;
+                while (verticeInicial < 0 || verticeInicial >= g->qnt_nos){
+                    cout << "Vértice inválido. Digite novamente: \n";
+                    cin >> verticeInicial;
+                }
+                cout << "Informe o arquivo com as consultas: ";
+                cin >> s;
+                {
+                    string saida;
+                    cout << "Informe o arquivo das respostas: ";
+                    cin >> saida;
+                    if (g->ancestraisEmLote(verticeInicial, s, saida)) {
+                        cout << "Respostas salvas em " << saida << '\n';
+                    } else {
+                        cout << "Não foi possível abrir os arquivos\n";
+                    }
+                }
+                cout << "\nDigite ENTER para voltar ao menu\n";
+                getChar();
+                break;
+
             case ESC:
                 break;
 
@@ -0,0 +1,143 @@
+/**
+ * @file arquivo_mapeado.hpp
+ * @author Victor Emanuel Almeida e Milena Lucas dos Santos
+ * @brief Define a classe ArquivoMapeado
+ *
+ * Dá acesso ao conteúdo de um arquivo como um vetor de bytes,
+ * no linux usando mmap, sem copiar o arquivo para a memória
+ * @version 0.1
+ * @date 17/10/2026
+ */
+
+#ifndef ARQUIVO_MAPEADO
+#define ARQUIVO_MAPEADO
+
+#include <cstddef>
+#include <string>
+
+#ifdef __gnu_linux__
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#else
+
+#include <fstream>
+
+#endif //__gnu_linux__
+
+/**
+ * @brief Arquivo somente leitura mapeado na memória
+ *
+ * O mapeamento é desfeito no destrutor
+ */
+class ArquivoMapeado {
+    private:
+    char *dados;  /// início do conteúdo do arquivo
+    size_t tam;  /// tamanho do arquivo em bytes
+
+    public:
+    /**
+     * @brief Construtor da classe ArquivoMapeado
+     *
+     * @pre Nenhuma
+     * @post Nenhum arquivo mapeado
+     */
+    ArquivoMapeado() {
+        dados = nullptr;
+        tam = 0;
+    }
+
+    ArquivoMapeado(const ArquivoMapeado &) = delete;
+    ArquivoMapeado& operator = (const ArquivoMapeado &) = delete;
+
+#ifdef __gnu_linux__
+
+    /**
+     * @brief Mapeia o arquivo na memória
+     *
+     * @param filename o nome do arquivo a ser lido
+     * @return true se o arquivo foi mapeado
+     * @return false se o arquivo não existe ou não pode ser lido
+     * @pre Nenhum arquivo mapeado
+     * @post conteúdo do arquivo acessível por inicio()
+     */
+    bool abre(const std::string &filename) {
+        int fd = open(filename.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return false;
+        }
+        struct stat info;
+        if (fstat(fd, &info) < 0) {
+            close(fd);
+            return false;
+        }
+        tam = info.st_size;
+        if (tam > 0) {
+            void *p = mmap(nullptr, tam, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p == MAP_FAILED) {
+                close(fd);
+                tam = 0;
+                return false;
+            }
+            dados = (char*)p;
+            // o arquivo é lido de uma vez, do início ao fim. Os conselhos
+            // do madvise não são bits, cada um precisa da própria chamada
+            madvise(p, tam, MADV_SEQUENTIAL);
+            madvise(p, tam, MADV_WILLNEED);
+        }
+        close(fd);
+        return true;
+    }
+
+    ~ArquivoMapeado() {
+        if (dados) {
+            munmap(dados, tam);
+        }
+    }
+
+#else
+
+    bool abre(const std::string &filename) {
+        std::ifstream file(filename, std::ios::binary | std::ios::ate);
+        if (!file.is_open()) {
+            return false;
+        }
+        tam = file.tellg();
+        file.seekg(0);
+        dados = new char[tam];
+        file.read(dados, tam);
+        return true;
+    }
+
+    ~ArquivoMapeado() {
+        delete[] dados;
+    }
+
+#endif //__gnu_linux__
+
+    /**
+     * @brief Ponteiro para o primeiro byte do arquivo
+     */
+    const char *inicio() const {
+        return dados;
+    }
+
+    /**
+     * @brief Ponteiro para a posição seguinte ao último byte do arquivo
+     */
+    const char *fim() const {
+        return dados + tam;
+    }
+
+    /**
+     * @brief Tamanho do arquivo em bytes
+     */
+    size_t tamanho() const {
+        return tam;
+    }
+};
+
+#endif // ARQUIVO_MAPEADO
@@ -0,0 +1,57 @@
+/**
+ * @file bitmap.hpp
+ * @author Victor Emanuel Almeida e Milena Lucas dos Santos
+ * @brief Define a classe Bitmap
+ *
+ * @version 0.1
+ * @date 17/10/2026
+ */
+
+#ifndef BITMAP
+#define BITMAP
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Conjunto de inteiros em [0, tam) com um bit por elemento
+ *
+ * Utilizado nas buscas, percorrer as palavras permite pular 64
+ * elementos de uma vez
+ */
+class Bitmap {
+    private:
+    std::vector<uint64_t> palavras;
+
+    public:
+    Bitmap(int tam) : palavras((tam + 63) / 64, 0) {
+    }
+
+    bool testa(int i) const {
+        return (palavras[i >> 6] >> (i & 63)) & 1;
+    }
+
+    void marca(int i) {
+        palavras[i >> 6] |= 1ULL << (i & 63);
+    }
+
+    void desmarca(int i) {
+        palavras[i >> 6] &= ~(1ULL << (i & 63));
+    }
+
+    /**
+     * @brief Quantidade de palavras de 64 bits
+     */
+    int qntPalavras() const {
+        return palavras.size();
+    }
+
+    /**
+     * @brief Palavra k, com os elementos [64k, 64k + 64)
+     */
+    uint64_t palavra(int k) const {
+        return palavras[k];
+    }
+};
+
+#endif // BITMAP
@@ -0,0 +1,148 @@
+/**
+ * @file contadores_hw.hpp
+ * @author Victor Emanuel Almeida e Milena Lucas dos Santos
+ * @brief Contadores de desempenho do processador lidos com perf_event_open
+ *
+ * Usado pela instrumentação quando a variável de ambiente
+ * PAA_CONTADORES_HW está definida. Fora do Linux, ou sem permissão para
+ * os eventos (ex.: perf_event_paranoid alto, máquina virtual sem PMU),
+ * os contadores ficam indisponíveis e só os tempos são medidos
+ * @version 0.1
+ * @date 17/10/2026
+ */
+
+#ifndef CONTADORES_HW
+#define CONTADORES_HW
+
+#include <cerrno>
+#include <cstring>
+#include <string>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief enumera os eventos de hardware medidos
+ */
+enum eventoHW {
+    CICLOS,
+    INSTRUCOES,
+    FALTAS_LLC,  /// faltas no último nível de cache
+    ERROS_DESVIO,  /// desvios previstos errado
+    FALTAS_DTLB,  /// faltas de leitura na TLB de dados
+    QNT_EVENTOS_HW
+};
+
+/**
+ * @brief Abre um contador por evento para o processo, somente em modo
+ * usuário
+ *
+ * Os contadores são herdados pelas threads criadas depois da abertura e
+ * a leitura soma as de todas elas, então devem ser abertos antes do pool
+ * de threads existir para as buscas paralelas serem contadas
+ */
+class ContadoresHW {
+    private:
+    int fd[QNT_EVENTOS_HW];
+    std::string erro;  /// motivo do primeiro evento que não abriu
+
+    public:
+    ContadoresHW() {
+        for (int i = 0; i < QNT_EVENTOS_HW; i++) {
+            fd[i] = -1;
+        }
+#ifdef __linux__
+        const unsigned int tipo[QNT_EVENTOS_HW] = {
+            PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE,
+            PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE
+        };
+        const unsigned long long config[QNT_EVENTOS_HW] = {
+            PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+            PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES,
+            PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)
+        };
+        for (int i = 0; i < QNT_EVENTOS_HW; i++) {
+            perf_event_attr attr;
+            memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = tipo[i];
+            attr.config = config[i];
+            attr.inherit = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            // com mais eventos que registradores o kernel reveza os
+            // contadores, os tempos permitem estimar o total
+            attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            fd[i] = (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+            if (fd[i] < 0 && erro.empty()) {
+                erro = strerror(errno);
+            }
+        }
+#else
+        erro = "perf_event_open existe somente no Linux";
+#endif
+    }
+
+    ContadoresHW(const ContadoresHW&) = delete;
+    ContadoresHW &operator=(const ContadoresHW&) = delete;
+
+    /**
+     * @brief Informa se o evento pôde ser aberto
+     */
+    bool disponivel(int evento) const {
+        return fd[evento] >= 0;
+    }
+
+    /**
+     * @brief Informa se ao menos um evento pôde ser aberto
+     */
+    bool algumDisponivel() const {
+        for (int i = 0; i < QNT_EVENTOS_HW; i++) {
+            if (fd[i] >= 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Motivo do primeiro evento que não abriu, vazio se todos abriram
+     */
+    const std::string &motivo() const {
+        return erro;
+    }
+
+    /**
+     * @brief Lê o valor atual de todos os eventos, 0 nos indisponíveis
+     *
+     * @param valor recebe QNT_EVENTOS_HW valores, estimados pela fração
+     * do tempo em que o evento esteve realmente sendo contado
+     */
+    void le(double valor[QNT_EVENTOS_HW]) const {
+        for (int i = 0; i < QNT_EVENTOS_HW; i++) {
+            valor[i] = 0;
+#ifdef __linux__
+            unsigned long long buf[3];  // valor, habilitado, executando
+            if (fd[i] >= 0 && read(fd[i], buf, sizeof(buf)) == (ssize_t)sizeof(buf) && buf[2] > 0) {
+                valor[i] = (double)buf[0] * ((double)buf[1] / buf[2]);
+            }
+#endif
+        }
+    }
+
+    ~ContadoresHW() {
+#ifdef __linux__
+        for (int i = 0; i < QNT_EVENTOS_HW; i++) {
+            if (fd[i] >= 0) {
+                close(fd[i]);
+            }
+        }
+#endif
+    }
+};
+
+#endif // CONTADORES_HW
@@ -0,0 +1,66 @@
+/**
+ * @file distancia_atomica.hpp
+ * @author Victor Emanuel Almeida e Milena Lucas dos Santos
+ * @brief Distância e predecessor de um vértice em um único inteiro atômico
+ *
+ * Utilizado nos algoritmos de menor caminho paralelos, onde várias
+ * threads podem relaxar arestas que chegam no mesmo vértice
+ * @version 0.1
+ * @date 17/10/2026
+ */
+
+#ifndef DISTANCIA_ATOMICA
+#define DISTANCIA_ATOMICA
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @brief Junta distância e predecessor em 64 bits
+ *
+ * A distância fica nos 32 bits mais significativos, com o bit de sinal
+ * invertido para que a ordem dos inteiros sem sinal seja a mesma das
+ * distâncias
+ */
+inline uint64_t empacota(int dist, int pred) {
+    return ((uint64_t)((uint32_t)dist ^ 0x80000000u) << 32) | (uint32_t)pred;
+}
+
+/**
+ * @brief Distância guardada por empacota
+ */
+inline int distEmpacotada(uint64_t x) {
+    return (int)((uint32_t)(x >> 32) ^ 0x80000000u);
+}
+
+/**
+ * @brief Predecessor guardado por empacota
+ */
+inline int predEmpacotado(uint64_t x) {
+    return (int)(uint32_t)x;
+}
+
+/**
+ * @brief Relaxamento atômico: troca distância e predecessor juntos,
+ * somente se a nova distância for menor
+ *
+ * @param estado distância e predecessor atuais do vértice
+ * @param dist nova distância
+ * @param pred novo predecessor
+ * @return true se a distância diminuiu
+ * @return false se a distância atual já era menor ou igual
+ * @pre Nenhuma
+ * @post Nenhuma
+ */
+inline bool diminuiAtomico(std::atomic<uint64_t> &estado, int dist, int pred) {
+    uint64_t atual = estado.load(std::memory_order_relaxed);
+    uint64_t novo = empacota(dist, pred);
+    while (dist < distEmpacotada(atual)) {
+        if (estado.compare_exchange_weak(atual, novo, std::memory_order_relaxed)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+#endif // DISTANCIA_ATOMICA
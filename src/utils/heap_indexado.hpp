@@ -0,0 +1,120 @@
+/**
+ * @file heap_indexado.hpp
+ * @author Victor Emanuel Almeida e Milena Lucas dos Santos
+ * @brief Heap d-ário de mínimo indexado pelos vértices
+ *
+ * @version 0.1
+ * @date 17/10/2026
+ */
+
+#ifndef HEAP_INDEXADO
+#define HEAP_INDEXADO
+
+#include "debug.hpp"
+
+template<class Chave, int D = 4>
+/**
+ * @brief Heap d-ário de mínimo cujos elementos são os inteiros [0, capacidade)
+ *
+ * Guarda a posição de cada elemento no heap, assim é possível
+ * diminuir a chave de um elemento em O(log_D n). Utilizado no
+ * algoritmo de Prim
+ */
+class HeapIndexado {
+    private:
+        int tam;  /// quantidade de elementos no heap
+        int *heap;  /// elementos, o mínimo está na posição 0
+        int *posicao;  /// posição de cada elemento no heap, -1 se fora
+        Chave *chaves;  /// chave de cada elemento
+
+        void troca(int i, int j) {
+            int a = heap[i];
+            heap[i] = heap[j];
+            heap[j] = a;
+            posicao[heap[i]] = i;
+            posicao[heap[j]] = j;
+        }
+
+        void sobe(int i) {
+            while (i > 0) {
+                int p = (i - 1) / D;
+                if (!(chaves[heap[i]] < chaves[heap[p]])) {
+                    break;
+                }
+                troca(i, p);
+                i = p;
+            }
+        }
+
+        void desce(int i) {
+            while (true) {
+                int menor = i;
+                int primeiro = D * i + 1;
+                for (int f = primeiro; f < primeiro + D && f < tam; f++) {
+                    if (chaves[heap[f]] < chaves[heap[menor]]) {
+                        menor = f;
+                    }
+                }
+                if (menor == i) {
+                    break;
+                }
+                troca(i, menor);
+                i = menor;
+            }
+        }
+
+    public:
+        HeapIndexado(int capacidade) {
+            tam = 0;
+            heap = new int[capacidade];
+            posicao = new int[capacidade];
+            chaves = new Chave[capacidade];
+            for (int i = 0; i < capacidade; i++) {
+                posicao[i] = -1;
+            }
+        }
+
+        HeapIndexado(const HeapIndexado &) = delete;
+        HeapIndexado& operator = (const HeapIndexado &) = delete;
+
+        bool isVazio() {
+            return tam == 0;
+        }
+
+        bool contem(int v) {
+            return posicao[v] != -1;
+        }
+
+        const Chave &chave(int v) {
+            return chaves[v];
+        }
+
+        void insere(int v, const Chave &chave) {
+            chaves[v] = chave;
+            heap[tam] = v;
+            posicao[v] = tam++;
+            sobe(tam - 1);
+        }
+
+        // chave deve ser menor ou igual a atual
+        void diminui(int v, const Chave &chave) {
+            chaves[v] = chave;
+            sobe(posicao[v]);
+        }
+
+        int retiraMinimo() {
+            int v = heap[0];
+            troca(0, --tam);
+            posicao[v] = -1;
+            desce(0);
+            return v;
+        }
+
+        ~HeapIndexado() {
+            delete[] heap;
+            delete[] posicao;
+            delete[] chaves;
+        }
+};
+
+#endif // HEAP_INDEXADO
@@ -0,0 +1,97 @@
+/**
+ * @file heap_radix.hpp
+ * @author Victor Emanuel Almeida e Milena Lucas dos Santos
+ * @brief Define a classe HeapRadix
+ *
+ * @version 0.1
+ * @date 17/10/2026
+ */
+
+#ifndef HEAP_RADIX
+#define HEAP_RADIX
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Fila de prioridade monótona para chaves inteiras sem sinal
+ * (radix heap)
+ *
+ * Nenhuma chave inserida pode ser menor que a última retirada, o que
+ * vale para as distâncias do Dijkstra com pesos não negativos. O balde
+ * de uma chave é a posição do bit mais significativo em que ela difere
+ * da última chave retirada, assim cada elemento muda de balde no máximo
+ * 64 vezes
+ */
+class HeapRadix {
+    private:
+    typedef std::pair<uint64_t, int> Elemento;
+    std::vector<Elemento> baldes[65];
+    uint64_t ultimo;  /// última chave retirada
+    long long tam;
+
+    int balde(uint64_t chave) const {
+        return (chave == ultimo) ? 0 : 64 - __builtin_clzll(chave ^ ultimo);
+    }
+
+    public:
+    HeapRadix() {
+        ultimo = 0;
+        tam = 0;
+    }
+
+    bool isVazio() const {
+        return tam == 0;
+    }
+
+    /**
+     * @brief Esvazia o heap, permitindo chaves a partir de zero novamente
+     */
+    void limpar() {
+        for (auto &b : baldes) {
+            b.clear();
+        }
+        ultimo = 0;
+        tam = 0;
+    }
+
+    // chave deve ser maior ou igual a última retirada
+    void insere(uint64_t chave, int valor) {
+        baldes[balde(chave)].emplace_back(chave, valor);
+        tam++;
+    }
+
+    /**
+     * @brief Retira um elemento de menor chave
+     *
+     * Quando o balde 0 está vazio, o primeiro balde não vazio é
+     * redistribuído a partir da sua menor chave
+     * @pre heap não vazio
+     */
+    Elemento retiraMinimo() {
+        if (baldes[0].empty()) {
+            int i = 1;
+            while (baldes[i].empty()) {
+                i++;
+            }
+            uint64_t menor = baldes[i][0].first;
+            for (auto &x : baldes[i]) {
+                if (x.first < menor) {
+                    menor = x.first;
+                }
+            }
+            ultimo = menor;
+            for (auto &x : baldes[i]) {
+                baldes[balde(x.first)].push_back(x);
+            }
+            baldes[i].clear();
+        }
+        Elemento x = baldes[0].back();
+        baldes[0].pop_back();
+        tam--;
+        return x;
+    }
+};
+
+#endif // HEAP_RADIX
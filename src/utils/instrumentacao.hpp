@@ -0,0 +1,309 @@
+/**
+ * @file instrumentacao.hpp
+ * @author Victor Emanuel Almeida e Milena Lucas dos Santos
+ * @brief Contadores e medição do tempo das fases dos algoritmos
+ *
+ * Assim como o debug, só existe quando compilado com INSTRUMENTACAO_VAR,
+ * caso contrário as macros não geram nenhum código
+ * @version 0.1
+ * @date 17/10/2026
+ */
+
+#ifndef INSTRUMENTACAO
+#define INSTRUMENTACAO
+
+/**
+ * @brief enumera os contadores da instrumentação
+ */
+enum contador {
+    ARESTAS_VISITADAS,  /// entradas das listas de adjacência percorridas
+    RELAXACOES,  /// relaxações que diminuíram uma distância
+    PASSADAS_BELLMAN_FORD,  /// passadas por todas as arestas
+    OPERACOES_UNIAO_BUSCA,  /// chamadas de acha e une do ConjuntoDisjunto
+    VERTICES_ENFILEIRADOS,  /// vértices alcançados pelas buscas em largura
+    QNT_CONTADORES
+};
+
+#ifdef INSTRUMENTACAO_VAR
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "contadores_hw.hpp"
+
+/**
+ * @brief Guarda os contadores e os tempos das fases
+ *
+ * Cada thread soma nos próprios contadores, sem disputar a mesma linha
+ * de cache, e o relatório soma os de todas as threads
+ */
+class Instrumentacao {
+    public:
+    /**
+     * @brief Contadores de uma thread, somente ela escreve neles
+     */
+    struct Contadores {
+        std::atomic<long long> valor[QNT_CONTADORES];
+    };
+
+    /**
+     * @brief Tempo acumulado de uma fase e, com PAA_CONTADORES_HW, os
+     * eventos de hardware e as arestas visitadas durante ela
+     */
+    struct Fase {
+        long long chamadas;
+        double total_ms;
+        double hw[QNT_EVENTOS_HW];
+        long long arestas;
+    };
+
+    /**
+     * @brief Instante de início ou fim de um trecho de uma fase
+     */
+    struct Marca {
+        std::chrono::steady_clock::time_point tempo;
+        double hw[QNT_EVENTOS_HW];
+        long long arestas;
+    };
+
+    /**
+     * @brief Mede o tempo entre a construção e a destruição, somando
+     * na fase com o nome dado
+     *
+     * Enquanto uma fase mais interna está ativa na mesma thread a externa
+     * fica parada, assim cada instante é contado em uma única fase
+     * (ex.: a impressão não entra no tempo do cálculo que a chamou). Os
+     * eventos de hardware são do processo inteiro, então incluem as
+     * threads do pool que trabalham para a fase
+     */
+    class Cronometro {
+        private:
+        const char *nome;
+        Cronometro *externo;  /// fase ativa quando esta começou
+        Marca inicio;
+        Fase acumulado;
+
+        static Cronometro *&ativo() {
+            thread_local Cronometro *c = nullptr;
+            return c;
+        }
+
+        void pausa(const Marca &agora) {
+            acumulado.total_ms += std::chrono::duration<double, std::milli>(agora.tempo - inicio.tempo).count();
+            for (int i = 0; i < QNT_EVENTOS_HW; i++) {
+                acumulado.hw[i] += agora.hw[i] - inicio.hw[i];
+            }
+            acumulado.arestas += agora.arestas - inicio.arestas;
+        }
+
+        public:
+        Cronometro(const char *nome) : nome(nome), externo(ativo()), acumulado() {
+            inicio = global().marca();
+            if (externo != nullptr) {
+                externo->pausa(inicio);
+            }
+            ativo() = this;
+        }
+
+        ~Cronometro() {
+            Instrumentacao &inst = global();
+            Marca agora = inst.marca();
+            pausa(agora);
+            ativo() = externo;
+            if (externo != nullptr) {
+                externo->inicio = agora;
+            }
+            std::lock_guard<std::mutex> trava(inst.trava);
+            Fase &f = inst.fases[nome];
+            f.chamadas++;
+            f.total_ms += acumulado.total_ms;
+            for (int i = 0; i < QNT_EVENTOS_HW; i++) {
+                f.hw[i] += acumulado.hw[i];
+            }
+            f.arestas += acumulado.arestas;
+        }
+    };
+
+    static Instrumentacao &global() {
+        static Instrumentacao inst;
+        return inst;
+    }
+
+    /**
+     * @brief Contadores da thread atual, criados no primeiro uso
+     */
+    static Contadores &daThread() {
+        thread_local Contadores *c = nullptr;
+        if (c == nullptr) {
+            c = new Contadores();
+            for (int i = 0; i < QNT_CONTADORES; i++) {
+                c->valor[i].store(0, std::memory_order_relaxed);
+            }
+            Instrumentacao &inst = global();
+            std::lock_guard<std::mutex> trava(inst.trava);
+            inst.threads.push_back(c);
+        }
+        return *c;
+    }
+
+    /**
+     * @brief Soma n no contador da thread atual
+     */
+    static void soma(contador qual, long long n) {
+        std::atomic<long long> &v = daThread().valor[qual];
+        v.store(v.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Lê o relógio e, se habilitados, os eventos de hardware e o
+     * total de arestas visitadas por todas as threads
+     */
+    Marca marca() {
+        Marca m;
+        m.arestas = 0;
+        if (hw != nullptr) {
+            hw->le(m.hw);
+            std::lock_guard<std::mutex> trava(this->trava);
+            for (Contadores *c : threads) {
+                m.arestas += c->valor[ARESTAS_VISITADAS].load(std::memory_order_relaxed);
+            }
+        } else {
+            for (int i = 0; i < QNT_EVENTOS_HW; i++) {
+                m.hw[i] = 0;
+            }
+        }
+        m.tempo = std::chrono::steady_clock::now();
+        return m;
+    }
+
+    /**
+     * @brief Escreve os contadores e as fases em JSON
+     */
+    void escreveJSON(std::ostream &out) {
+        static const char *const nomes[QNT_CONTADORES] = {
+            "arestas_visitadas", "relaxacoes", "passadas_bellman_ford",
+            "operacoes_uniao_busca", "vertices_enfileirados"
+        };
+        std::lock_guard<std::mutex> trava(this->trava);
+        out << "{\n  \"contadores\": {";
+        for (int i = 0; i < QNT_CONTADORES; i++) {
+            long long total = 0;
+            for (Contadores *c : threads) {
+                total += c->valor[i].load(std::memory_order_relaxed);
+            }
+            out << (i ? ",\n" : "\n") << "    \"" << nomes[i] << "\": " << total;
+        }
+        out << "\n  },\n  \"fases\": {";
+        bool primeira = true;
+        for (const auto &f : fases) {
+            out << (primeira ? "\n" : ",\n") << "    \"" << f.first
+                << "\": {\"chamadas\": " << f.second.chamadas << ", \"total_ms\": "
+                << std::fixed << std::setprecision(3) << f.second.total_ms;
+            if (hw != nullptr && hw->algumDisponivel()) {
+                escreveHW(out, f.second);
+            }
+            out << '}';
+            primeira = false;
+        }
+        out << "\n  }";
+        if (hw != nullptr && !hw->algumDisponivel()) {
+            out << ",\n  \"contadores_hw\": \"indisponível: " << hw->motivo() << '"';
+        }
+        out << "\n}\n";
+    }
+
+    /**
+     * @brief Escreve o JSON no arquivo da variável de ambiente
+     * PAA_INSTRUMENTACAO, ou na saída de erro
+     */
+    void relatorio() {
+        const char *arquivo = std::getenv("PAA_INSTRUMENTACAO");
+        if (arquivo != nullptr) {
+            std::ofstream file(arquivo, std::ios::trunc);
+            if (file.is_open()) {
+                escreveJSON(file);
+                return;
+            }
+        }
+        escreveJSON(std::cerr);
+    }
+
+    private:
+    /**
+     * @brief Escreve os eventos de hardware da fase, o IPC e as faltas
+     * por aresta visitada, null nos que não puderam ser medidos
+     */
+    void escreveHW(std::ostream &out, const Fase &f) {
+        static const char *const nomes[QNT_EVENTOS_HW] = {
+            "ciclos", "instrucoes", "faltas_llc", "erros_desvio", "faltas_dtlb"
+        };
+        out << std::setprecision(0);
+        for (int i = 0; i < QNT_EVENTOS_HW; i++) {
+            out << ", \"" << nomes[i] << "\": ";
+            if (hw->disponivel(i)) {
+                out << f.hw[i];
+            } else {
+                out << "null";
+            }
+        }
+        out << ", \"arestas\": " << f.arestas << std::setprecision(4) << ", \"ipc\": ";
+        if (hw->disponivel(CICLOS) && hw->disponivel(INSTRUCOES) && f.hw[CICLOS] > 0) {
+            out << f.hw[INSTRUCOES] / f.hw[CICLOS];
+        } else {
+            out << "null";
+        }
+        const int por_aresta[] = {FALTAS_LLC, ERROS_DESVIO, FALTAS_DTLB};
+        for (int i : por_aresta) {
+            out << ", \"" << nomes[i] << "_por_aresta\": ";
+            if (hw->disponivel(i) && f.arestas > 0) {
+                out << f.hw[i] / f.arestas;
+            } else {
+                out << "null";
+            }
+        }
+    }
+
+    /**
+     * @brief Abre os contadores de hardware se PAA_CONTADORES_HW estiver
+     * definida
+     *
+     * Construída pela primeira fase, que é a leitura do grafo, antes das
+     * threads do pool existirem
+     */
+    Instrumentacao() {
+        hw = std::getenv("PAA_CONTADORES_HW") != nullptr ? new ContadoresHW() : nullptr;
+    }
+
+    ~Instrumentacao() {
+        delete hw;
+    }
+
+    std::mutex trava;
+    ContadoresHW *hw;  /// nullptr sem PAA_CONTADORES_HW
+    std::vector<Contadores*> threads;  /// nunca desalocados, as threads do
+    /// pool vivem até o fim do programa
+    std::map<std::string, Fase> fases;
+};
+
+#define INSTRUMENTACAO_NOME_(a, b) a##b
+#define INSTRUMENTACAO_NOME(a, b) INSTRUMENTACAO_NOME_(a, b)
+
+#define conta( qual, n ) Instrumentacao::soma(qual, n)
+#define cronometra( nome ) \
+    Instrumentacao::Cronometro INSTRUMENTACAO_NOME(cronometro_, __LINE__)(nome)
+#define relatorioInstrumentacao() Instrumentacao::global().relatorio()
+
+#else
+#define conta( qual, n )
+#define cronometra( nome )
+#define relatorioInstrumentacao()
+#endif
+
+#endif // INSTRUMENTACAO
@@ -0,0 +1,132 @@
+/**
+ * @file ordenacao.hpp
+ * @author Victor Emanuel Almeida e Milena Lucas dos Santos
+ * @brief Ordenação estável de vetores por uma chave
+ *
+ * Chaves inteiras que cabem em um int são ordenadas com radix sort (LSD),
+ * as demais com uma ordenação por comparação
+ * @version 0.1
+ * @date 17/10/2026
+ */
+
+#ifndef ORDENACAO
+#define ORDENACAO
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "paralelo.hpp"
+
+/**
+ * @brief Abaixo desse tamanho a ordenação por comparação é mais rápida
+ * que o radix sort
+ */
+#define MIN_RADIX_SORT 256
+
+/**
+ * @brief Ordena um vetor pela chave inteira de cada elemento, usando
+ * radix sort LSD de 4 passadas de 8 bits
+ *
+ * O bit de sinal da chave é invertido, assim as chaves negativas ficam
+ * antes das positivas. Passadas em que todos os elementos têm o mesmo
+ * dígito são puladas. Vetores grandes são divididos em blocos, um por
+ * thread, cada um com seu histograma
+ * @param v vetor a ser ordenado
+ * @param n tamanho do vetor
+ * @param chave função que retorna a chave (int) de um elemento
+ * @pre T possui construtor padrão
+ * @post v ordenado pela chave, elementos com chaves iguais
+ * mantêm a ordem original
+ */
+template<class T, class F> void radixSort(T *v, long long n, F chave) {
+    if (n < 2) {
+        return;
+    }
+    int t = (n < MIN_ORDENA_PARALELO) ? 1 : qntThreads();
+    std::vector<long long> cont(256 * t);
+    T *aux = new T[n];
+    T *origem = v, *destino = aux;
+
+    auto digito = [&](const T &x, int desloc) {
+        return ((uint32_t)chave(x) ^ 0x80000000u) >> desloc & 0xFF;
+    };
+
+    for (int desloc = 0; desloc < 32; desloc += 8) {
+        // histograma de cada bloco
+        std::fill(cont.begin(), cont.end(), 0);
+        paraleloPara(t, [&](int, long long ini, long long fim) {
+            for (long long b = ini; b < fim; b++) {
+                long long *c = &cont[256 * b];
+                for (long long i = n * b / t; i < n * (b + 1) / t; i++) {
+                    c[digito(origem[i], desloc)]++;
+                }
+            }
+        });
+
+        // posição inicial de cada (dígito, bloco), na ordem dos blocos
+        // para manter a ordenação estável
+        long long soma = 0;
+        bool pula = false;
+        for (int d = 0; d < 256; d++) {
+            long long total = 0;
+            for (int b = 0; b < t; b++) {
+                long long qnt = cont[256 * b + d];
+                cont[256 * b + d] = soma;
+                soma += qnt;
+                total += qnt;
+            }
+            if (total == n) {
+                pula = true;
+            }
+        }
+        if (pula) {
+            continue;
+        }
+
+        paraleloPara(t, [&](int, long long ini, long long fim) {
+            for (long long b = ini; b < fim; b++) {
+                long long *c = &cont[256 * b];
+                for (long long i = n * b / t; i < n * (b + 1) / t; i++) {
+                    destino[c[digito(origem[i], desloc)]++] = origem[i];
+                }
+            }
+        });
+        std::swap(origem, destino);
+    }
+
+    if (origem != v) {
+        std::copy(origem, origem + n, v);
+    }
+    delete[] aux;
+}
+
+/**
+ * @brief Ordena um vetor pela chave de cada elemento, de forma estável
+ *
+ * Chaves inteiras que cabem em um int usam radixSort, qualquer outro tipo
+ * de chave usa std::stable_sort com o operador <
+ * @param v vetor a ser ordenado
+ * @param n tamanho do vetor
+ * @param chave função que retorna a chave de um elemento
+ * @pre a chave possui o operador <
+ * @post v ordenado pela chave, elementos com chaves iguais
+ * mantêm a ordem original
+ */
+template<class T, class F> void ordenaPorChave(T *v, long long n, F chave) {
+    typedef typename std::decay<decltype(chave(*v))>::type Chave;
+    if constexpr (std::is_integral<Chave>::value &&
+                  (sizeof(Chave) < sizeof(int) ||
+                   (sizeof(Chave) == sizeof(int) && std::is_signed<Chave>::value))) {
+        if (n >= MIN_RADIX_SORT) {
+            radixSort(v, n, [&](const T &x) { return (int)chave(x); });
+            return;
+        }
+    }
+    std::stable_sort(v, v + n, [&](const T &a, const T &b) {
+        return chave(a) < chave(b);
+    });
+}
+
+#endif // ORDENACAO
@@ -0,0 +1,180 @@
+/**
+ * @file paralelo.hpp
+ * @author Victor Emanuel Almeida e Milena Lucas dos Santos
+ * @brief Funções auxiliares para dividir trabalho entre threads
+ *
+ * @version 0.1
+ * @date 17/10/2026
+ */
+
+#ifndef PARALELO
+#define PARALELO
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include "pool_threads.hpp"
+
+/**
+ * @brief Tamanho mínimo de um vetor para valer a pena ordená-lo
+ * com mais de uma thread
+ */
+#define MIN_ORDENA_PARALELO (1 << 16)
+
+/**
+ * @brief Informa quantas threads os algoritmos paralelos devem usar
+ *
+ * Pode ser alterado pela variável de ambiente PAA_THREADS
+ * @return int quantidade de threads, no mínimo 1
+ */
+inline int qntThreads() {
+    static int qnt = 0;
+    if (qnt == 0) {
+        const char *env = std::getenv("PAA_THREADS");
+        qnt = env ? std::atoi(env) : (int)std::thread::hardware_concurrency();
+        if (qnt < 1) {
+            qnt = 1;
+        }
+    }
+    return qnt;
+}
+
+/**
+ * @brief Pool de threads compartilhado por todos os algoritmos paralelos
+ *
+ * Criado na primeira chamada, com qntThreads() threads
+ */
+inline PoolThreads &poolGlobal() {
+    static PoolThreads pool(qntThreads());
+    return pool;
+}
+
+/**
+ * @brief Divide o intervalo [0, n) em blocos contíguos, um por thread
+ * do poolGlobal
+ *
+ * Quando chamada de dentro de uma tarefa do pool executa tudo
+ * na thread atual
+ * @param n tamanho do intervalo
+ * @param f função chamada como f(id_thread, inicio, fim)
+ * @pre Nenhuma
+ * @post f executada em todos os blocos
+ */
+template<class F> void paraleloPara(long long n, F f) {
+    int t = (int)std::min<long long>(qntThreads(), std::max(n, 1LL));
+    if (t == 1 || PoolThreads::isDentroDoPool()) {
+        f(0, 0LL, n);
+        return;
+    }
+    poolGlobal().executa(t, [&](int i) {
+        f(i, n * i / t, n * (i + 1) / t);
+    });
+}
+
+/**
+ * @brief Executa f para cada índice de [0, n) com roubo de trabalho,
+ * para tarefas de custo muito diferente entre si
+ *
+ * Cada thread começa com um bloco contíguo, guardado como início e fim
+ * em um único inteiro atômico. A dona retira do início e, quando o seu
+ * bloco acaba, rouba a metade final do bloco de outra thread
+ * @param n quantidade de índices
+ * @param f função chamada como f(id_thread, indice)
+ * @pre n < 2^31
+ * @post f executada uma vez para cada índice
+ */
+template<class F> void paraleloRoubo(int n, F f) {
+    int t = std::min(qntThreads(), std::max(n, 1));
+    if (t == 1 || PoolThreads::isDentroDoPool()) {
+        for (int i = 0; i < n; i++) {
+            f(0, i);
+        }
+        return;
+    }
+
+    auto junta = [](uint64_t ini, uint64_t fim) { return (ini << 32) | fim; };
+    std::vector<std::atomic<uint64_t>> blocos(t);
+    for (int i = 0; i < t; i++) {
+        blocos[i].store(junta((long long)n * i / t, (long long)n * (i + 1) / t));
+    }
+
+    poolGlobal().executa(t, [&](int id) {
+        while (true) {
+            uint64_t x = blocos[id].load();
+            while ((x >> 32) < (uint32_t)x) {
+                if (blocos[id].compare_exchange_weak(x, x + (1ULL << 32))) {
+                    f(id, (int)(x >> 32));
+                    x = blocos[id].load();
+                }
+            }
+
+            // o próprio bloco acabou, rouba de outra thread
+            bool roubou = false;
+            for (int k = 1; k < t && !roubou; k++) {
+                std::atomic<uint64_t> &vitima = blocos[(id + k) % t];
+                uint64_t y = vitima.load();
+                while (!roubou && (y >> 32) < (uint32_t)y) {
+                    uint64_t ini = y >> 32, fim = (uint32_t)y;
+                    uint64_t meio = fim - (fim - ini + 1) / 2;
+                    if (vitima.compare_exchange_weak(y, junta(ini, meio))) {
+                        blocos[id].store(junta(meio, fim));
+                        roubou = true;
+                    }
+                }
+            }
+            if (!roubou) {
+                return;
+            }
+        }
+    });
+}
+
+/**
+ * @brief Ordena um vetor, utilizando várias threads quando ele é grande
+ *
+ * Cada thread ordena um bloco, depois os blocos são intercalados
+ * 2 a 2, também em paralelo
+ * @param v vetor a ser ordenado
+ * @param n tamanho do vetor
+ * @param comp função de comparação, como em std::sort
+ * @pre Nenhuma
+ * @post v ordenado segundo comp
+ */
+template<class T, class C> void ordenaParalelo(T *v, long long n, C comp) {
+    int t = qntThreads();
+    if (t == 1 || n < MIN_ORDENA_PARALELO) {
+        std::sort(v, v + n, comp);
+        return;
+    }
+
+    std::vector<long long> limites(t + 1);
+    for (int i = 0; i <= t; i++) {
+        limites[i] = n * i / t;
+    }
+    paraleloPara(t, [&](int, long long ini, long long fim) {
+        for (long long b = ini; b < fim; b++) {
+            std::sort(v + limites[b], v + limites[b + 1], comp);
+        }
+    });
+
+    // intercala os blocos vizinhos até sobrar um só
+    for (int passo = 1; passo < t; passo *= 2) {
+        int pares = (t + 2 * passo - 1) / (2 * passo);
+        paraleloPara(pares, [&](int, long long ini, long long fim) {
+            for (long long p = ini; p < fim; p++) {
+                int b = 2 * passo * p;
+                if (b + passo < t) {
+                    std::inplace_merge(v + limites[b], v + limites[b + passo],
+                                       v + limites[std::min(b + 2 * passo, t)],
+                                       comp);
+                }
+            }
+        });
+    }
+}
+
+#endif // PARALELO
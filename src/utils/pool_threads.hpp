@@ -0,0 +1,161 @@
+/**
+ * @file pool_threads.hpp
+ * @author Victor Emanuel Almeida e Milena Lucas dos Santos
+ * @brief Define a classe PoolThreads
+ *
+ * Threads criadas uma única vez e reaproveitadas por todos os
+ * algoritmos paralelos, evitando criar threads a cada passada
+ * @version 0.1
+ * @date 17/10/2026
+ */
+
+#ifndef POOL_THREADS
+#define POOL_THREADS
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Conjunto fixo de threads que executam a mesma tarefa,
+ * cada uma com o seu identificador
+ *
+ * A thread que chama executa participa como a de identificador 0
+ * e só retorna quando todas terminam
+ */
+class PoolThreads {
+    private:
+    std::vector<std::thread> threads;
+    std::mutex trava;
+    std::condition_variable tem_tarefa;
+    std::condition_variable terminou;
+    std::function<void(int)> tarefa;  /// tarefa atual
+    int qnt_tarefa;  /// quantas threads executam a tarefa atual
+    int pendentes;  /// threads que ainda não terminaram a tarefa atual
+    long long geracao;  /// incrementada a cada tarefa nova
+    bool encerrar;
+
+    /**
+     * @brief Indica se a thread atual pertence a algum pool
+     */
+    static bool &isTrabalhador() {
+        static thread_local bool trabalhador = false;
+        return trabalhador;
+    }
+
+    void trabalha(int id) {
+        isTrabalhador() = true;
+        long long vista = 0;
+        while (true) {
+            std::function<void(int)> atual;
+            {
+                std::unique_lock<std::mutex> lock(trava);
+                tem_tarefa.wait(lock, [&]() {
+                    return encerrar || geracao != vista;
+                });
+                if (encerrar) {
+                    return;
+                }
+                vista = geracao;
+                if (id >= qnt_tarefa) {
+                    continue;
+                }
+                atual = tarefa;
+            }
+            atual(id);
+            std::lock_guard<std::mutex> lock(trava);
+            if (--pendentes == 0) {
+                terminou.notify_one();
+            }
+        }
+    }
+
+    public:
+    /**
+     * @brief Construtor da classe PoolThreads
+     *
+     * @param qnt quantidade total de threads, contando a que chama executa
+     * @pre qnt >= 1
+     * @post qnt - 1 threads criadas e esperando tarefas
+     */
+    PoolThreads(int qnt) {
+        qnt_tarefa = pendentes = 0;
+        geracao = 0;
+        encerrar = false;
+        for (int i = 1; i < qnt; i++) {
+            threads.emplace_back(&PoolThreads::trabalha, this, i);
+        }
+    }
+
+    PoolThreads(const PoolThreads &) = delete;
+    PoolThreads& operator = (const PoolThreads &) = delete;
+
+    /**
+     * @brief Quantidade total de threads, contando a que chama executa
+     */
+    int tam() const {
+        return threads.size() + 1;
+    }
+
+    /**
+     * @brief Informa se a thread atual é uma thread de algum pool
+     *
+     * Uma tarefa não pode chamar executa novamente, nesse caso
+     * o trabalho deve ser feito na própria thread
+     */
+    static bool isDentroDoPool() {
+        return isTrabalhador();
+    }
+
+    /**
+     * @brief Executa f(id) para id em [0, qnt), cada um em uma thread
+     *
+     * @param qnt quantas threads executam a tarefa, no máximo tam()
+     * @param f tarefa
+     * @pre Não é chamada de dentro de uma tarefa
+     * @post f executada por todas as threads
+     */
+    void executa(int qnt, const std::function<void(int)> &f) {
+        if (qnt <= 1) {
+            f(0);
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(trava);
+            tarefa = f;
+            qnt_tarefa = qnt;
+            pendentes = qnt - 1;
+            geracao++;
+        }
+        tem_tarefa.notify_all();
+
+        isTrabalhador() = true;
+        f(0);
+        isTrabalhador() = false;
+
+        std::unique_lock<std::mutex> lock(trava);
+        terminou.wait(lock, [&]() { return pendentes == 0; });
+        tarefa = nullptr;
+    }
+
+    /**
+     * @brief Destrutor da classe PoolThreads
+     *
+     * @pre Nenhuma tarefa em execução
+     * @post Todas as threads finalizadas
+     */
+    ~PoolThreads() {
+        {
+            std::lock_guard<std::mutex> lock(trava);
+            encerrar = true;
+        }
+        tem_tarefa.notify_all();
+        for (auto &th : threads) {
+            th.join();
+        }
+    }
+};
+
+#endif // POOL_THREADS